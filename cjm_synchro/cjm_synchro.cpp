@@ -3,14 +3,45 @@
 #include <shared_mutex>
 #include <mutex>
 #include <iostream>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include "cjm_synchro_concepts.hpp"
 #include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro_parking_lot.hpp"
+#include "cjm_synchro_adaptive_mutex.hpp"
+#include "cjm_synchro_distributed_shared_mutex.hpp"
+#include "cjm_synchro_mcs_mutex.hpp"
+#include "cjm_synchro_async.hpp"
+#include "cjm_synchro_atomic_vault.hpp"
+#include "cjm_synchro_sharded_vault.hpp"
+#include "cjm_synchro_rcu.hpp"
+#include "cjm_synchro_left_right.hpp"
+#include "cjm_synchro_combining.hpp"
+#include "cjm_synchro_delegating.hpp"
+#include "cjm_synchro_keyed_wait.hpp"
+#include "cjm_synchro_trace.hpp"
+#include "cjm_synchro_vault_array.hpp"
+#include "cjm_synchro_bounded_queue.hpp"
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <future>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/shared_mutex.hpp>
 
 
 void test_upgrade_mutex();
+bool run_smoke_checks();
 
 
 int main()
@@ -60,6 +91,31 @@ int main()
 	static_assert(level_v<std::shared_timed_mutex> == mutex_level::shared);
 	static_assert(level_v<boost::upgrade_mutex> == mutex_level::upgrade);
 	static_assert(level_v<boost::shared_timed_mutex> == mutex_level::upgrade);
+	static_assert(mutex<cjm::synchro::byte_mutex>);
+	static_assert(level_v<cjm::synchro::byte_mutex> == mutex_level::basic);
+	static_assert(sizeof(cjm::synchro::byte_mutex) == 1);
+	static_assert(mutex<cjm::synchro::adaptive_mutex>);
+	static_assert(lockable<cjm::synchro::adaptive_mutex>);
+	static_assert(timed_mutex<cjm::synchro::adaptive_timed_mutex>);
+	static_assert(timed_lockable<cjm::synchro::adaptive_timed_mutex>);
+	static_assert(level_v<cjm::synchro::adaptive_mutex> == mutex_level::basic);
+	static_assert(time_library_v<cjm::synchro::adaptive_timed_mutex, mutex_level::basic> == time_type::std);
+	static_assert(shared_mutex<cjm::synchro::distributed_shared_mutex>);
+	static_assert(timed_mutex<cjm::synchro::distributed_shared_mutex>);
+	static_assert(shared_timed_lockable<cjm::synchro::distributed_shared_mutex>);
+	static_assert(level_v<cjm::synchro::distributed_shared_mutex> == mutex_level::shared);
+	static_assert(time_library_v<cjm::synchro::distributed_shared_mutex, mutex_level::shared> == time_type::std);
+	static_assert(mutex<cjm::synchro::mcs_mutex>);
+	static_assert(mutex<cjm::synchro::mcs_parking_mutex>);
+	static_assert(level_v<cjm::synchro::mcs_mutex> == mutex_level::basic);
+	static_assert(mutex<cjm::synchro::async_mutex>);
+	static_assert(level_v<cjm::synchro::async_mutex> == mutex_level::basic);
+	static_assert(shared_mutex<cjm::synchro::async_shared_mutex>);
+	static_assert(level_v<cjm::synchro::async_shared_mutex> == mutex_level::shared);
+	static_assert(std::is_same_v<cjm::synchro::vault_for_t<std::uint64_t>, cjm::synchro::atomic_vault<std::uint64_t>>);
+	static_assert(std::is_same_v<cjm::synchro::vault_for_t<std::string>, cjm::synchro::synchro_vault<std::string>>);
+	static_assert(cjm::synchro::sharded_vault<std::unordered_map<std::string, int>, 8, std::shared_mutex>::supports_shared);
+	static_assert(!cjm::synchro::sharded_vault<std::unordered_map<std::string, int>, 8>::supports_shared);
 
 	/*static_assert(time_library_v<std::mutex> == time_type::not_timed_or_unknown);
 	constexpr auto bm_val = time_library_v<boost::mutex>;
@@ -79,7 +135,12 @@ int main()
 	static_assert(time_library_v<boost::timed_mutex, mutex_level::basic> == time_type::boost);
 	static_assert(time_library_v<boost::shared_timed_mutex, mutex_level::basic> == time_type::boost);
 	static_assert(time_library_v<boost::shared_timed_mutex, mutex_level::shared> == time_type::boost);
-	
+
+	if (!run_smoke_checks())
+	{
+		return 1;
+	}
+	std::cout << "Smoke checks passed." << newl;
 	return 0;
 	
 }
@@ -100,6 +161,771 @@ void test_upgrade_mutex()
 	
 }
 
+namespace
+{
+	struct counted_record { std::size_t value{ 0 }; };
+	struct traced_record { std::size_t value{ 0 }; };
+	struct futex_record { std::size_t token{ 0 }; };
+	struct silent_record { std::size_t value{ 0 }; };
+	struct isolated_record { std::size_t value{ 0 }; };
+}
+
+template<>
+struct cjm::synchro::vault_traits<counted_record, std::shared_timed_mutex, cjm::synchro::concepts::mutex_level::shared>
+{
+	static constexpr stats_policy stats = stats_policy::enabled;
+};
+
+template<>
+struct cjm::synchro::vault_traits<traced_record, std::mutex, cjm::synchro::concepts::mutex_level::std_mutex>
+{
+	static constexpr stats_policy stats = stats_policy::traced;
+};
+
+template<>
+struct cjm::synchro::vault_traits<futex_record, std::mutex, cjm::synchro::concepts::mutex_level::std_mutex>
+{
+	static constexpr wait_policy wait = wait_policy::futex;
+};
+
+template<>
+struct cjm::synchro::vault_traits<silent_record, std::mutex, cjm::synchro::concepts::mutex_level::std_mutex>
+{
+	static constexpr wait_policy wait = wait_policy::none;
+};
+
+template<>
+struct cjm::synchro::vault_traits<isolated_record, std::mutex, cjm::synchro::concepts::mutex_level::std_mutex>
+{
+	static constexpr layout_policy layout = layout_policy::isolated_mutex;
+};
+
+namespace
+{
+	constexpr std::size_t smoke_threads = 4;
+	constexpr std::size_t smoke_iterations = 10'000;
+
+	// Runs body(index) on smoke_threads threads and joins them.
+	template<typename TBody>
+	void run_threads(TBody body)
+	{
+		std::vector<std::thread> threads;
+		for (std::size_t index = 0; index < smoke_threads; ++index)
+		{
+			threads.emplace_back([&body, index] { body(index); });
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	bool check(bool passed, const char* what)
+	{
+		if (!passed)
+		{
+			std::cerr << "Smoke check failed: " << what << '\n';
+		}
+		return passed;
+	}
+
+	// A shared lock may be released on a thread other than the one that took it, and a writer
+	// parked behind it must be woken by that release.
+	bool check_distributed_shared_mutex()
+	{
+		cjm::synchro::synchro_vault<int, cjm::synchro::distributed_shared_mutex> vault{};
+		auto reader = vault.lock_shared();
+		std::thread{ [moved = std::move(reader)]() mutable { auto released = std::move(moved); } }.join();
+		bool passed = check(static_cast<bool>(vault.try_lock_for(std::chrono::milliseconds{ 200 })),
+			"distributed_shared_mutex: writer after cross-thread unlock_shared");
+
+		auto second_reader = vault.lock_shared();
+		std::thread writer{ [&vault] { auto ptr = vault.lock(); *ptr = 1; } };
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+		std::thread{ [moved = std::move(second_reader)]() mutable { auto released = std::move(moved); } }.join();
+		writer.join();
+		passed = check(vault.copy_locked_datum() == 1, "distributed_shared_mutex: parked writer woken by another thread") && passed;
+
+		run_threads([&vault](std::size_t index)
+		{
+			for (std::size_t i = 0; i < smoke_iterations; ++i)
+			{
+				if (i % 4 == index % 4)
+				{
+					auto ptr = vault.lock();
+					++*ptr;
+				}
+				else
+				{
+					auto ptr = vault.lock_shared();
+				}
+			}
+		});
+		return check(vault.copy_locked_datum() == 1 + static_cast<int>(smoke_iterations), "distributed_shared_mutex: mixed readers and writers") && passed;
+	}
+
+	// Readers must only ever see published versions, and every superseded one must be freed.
+	bool check_rcu()
+	{
+		cjm::synchro::rcu_vault<std::vector<std::size_t>> vault{};
+		std::atomic<bool> torn{ false };
+		run_threads([&vault, &torn](std::size_t index)
+		{
+			for (std::size_t i = 0; i < smoke_iterations; ++i)
+			{
+				if (index == 0)
+				{
+					vault.update([i](std::vector<std::size_t>& values) { values.assign(8, i + 1); });
+				}
+				else
+				{
+					const auto snapshot = vault.read();
+					if (!snapshot->empty() && (snapshot->size() != 8 || snapshot->front() != snapshot->back()))
+					{
+						torn.store(true, std::memory_order_relaxed);
+					}
+				}
+			}
+		});
+		vault.synchronize();
+		const std::size_t last = vault.update([](std::vector<std::size_t>& values) { return values.back(); });
+		vault.synchronize();
+		return check(!torn.load(), "rcu_vault: torn read")
+			&& check(last == smoke_iterations, "rcu_vault: lost update")
+			&& check(vault.retired_count() == 0, "rcu_vault: superseded versions not reclaimed");
+	}
+
+	// Both copies must agree after concurrent writers, including after a mutator throws.
+	bool check_left_right()
+	{
+		cjm::synchro::left_right_vault<std::vector<std::size_t>> vault{};
+		std::atomic<bool> torn{ false };
+		run_threads([&vault, &torn](std::size_t index)
+		{
+			for (std::size_t i = 0; i < smoke_iterations; ++i)
+			{
+				if (index < 2)
+				{
+					vault.modify([](std::vector<std::size_t>& values) { values.push_back(values.size()); });
+				}
+				else if (vault.read([](const std::vector<std::size_t>& values) { return !values.empty() && values.back() + 1 != values.size(); }))
+				{
+					torn.store(true, std::memory_order_relaxed);
+				}
+			}
+		});
+		try
+		{
+			vault.modify([](std::vector<std::size_t>& values) { values.push_back(values.size()); throw std::runtime_error{ "abandoned" }; });
+		}
+		catch (const std::runtime_error&)
+		{
+		}
+		vault.modify([](std::vector<std::size_t>& values) { values.push_back(values.size()); });
+		const auto first = vault.copy_locked_datum();
+		vault.modify([](std::vector<std::size_t>&) {});
+		const auto second = vault.copy_locked_datum();
+		return check(!torn.load(), "left_right_vault: torn read")
+			&& check(first == second, "left_right_vault: copies diverged after a throwing mutator")
+			&& check(first.size() >= 2 * smoke_iterations + 1, "left_right_vault: lost update");
+	}
+
+	template<typename TMutex>
+	bool check_mcs(const char* what)
+	{
+		TMutex mutex{};
+		std::size_t counter = 0;
+		run_threads([&mutex, &counter](std::size_t)
+		{
+			for (std::size_t i = 0; i < smoke_iterations; ++i)
+			{
+				auto lck = std::unique_lock<TMutex>{ mutex };
+				++counter;
+			}
+		});
+		return check(counter == smoke_threads * smoke_iterations, what);
+	}
+
+	bool check_combining()
+	{
+		cjm::synchro::combining_vault<std::size_t> vault{};
+		std::atomic<bool> bad_result{ false };
+		run_threads([&vault, &bad_result](std::size_t index)
+		{
+			for (std::size_t i = 0; i < smoke_iterations; ++i)
+			{
+				// Plain holders now and then, so combiners also meet a mutex taken outside combine.
+				if (i % 64 == index)
+				{
+					auto ptr = vault.lock();
+					++*ptr;
+				}
+				else if (const std::size_t result = vault.combine([](std::size_t& value) { return ++value; });
+					result == 0 || result > smoke_threads * smoke_iterations)
+				{
+					bad_result.store(true, std::memory_order_relaxed);
+				}
+			}
+		});
+		return check(!bad_result.load(), "combining_vault: bad combine result")
+			&& check(vault.copy_locked_datum() == smoke_threads * smoke_iterations, "combining_vault: lost operation");
+	}
+
+	bool check_delegating()
+	{
+		cjm::synchro::delegating_vault<std::size_t> vault{};
+		std::atomic<bool> bad_future{ false };
+		run_threads([&vault, &bad_future](std::size_t index)
+		{
+			std::vector<std::future<std::size_t>> futures;
+			for (std::size_t i = 0; i < smoke_iterations; ++i)
+			{
+				if (i % 2 == index % 2)
+				{
+					vault.post([](std::size_t& value) { ++value; });
+				}
+				else
+				{
+					futures.push_back(vault.submit([](std::size_t& value) { return ++value; }));
+				}
+			}
+			for (auto& future : futures)
+			{
+				if (future.get() == 0)
+				{
+					bad_future.store(true, std::memory_order_relaxed);
+				}
+			}
+		});
+		auto thrown = vault.submit([](std::size_t&) -> int { throw std::runtime_error{ "delegated" }; });
+		bool propagated = false;
+		try
+		{
+			thrown.get();
+		}
+		catch (const std::runtime_error&)
+		{
+			propagated = true;
+		}
+		const std::size_t total = vault.submit([](std::size_t& value) { return value; }).get();
+
+		// Tasks that post a successor keep the queue from ever running dry; plain lock() callers
+		// must still get the mutex, because the executor releases it after every batch.
+		struct repost
+		{
+			cjm::synchro::delegating_vault<std::size_t>* vault;
+			const std::atomic<bool>* flooding;
+			void operator()(std::size_t& value) const
+			{
+				++value;
+				if (flooding->load(std::memory_order_relaxed))
+				{
+					vault->post(*this);
+				}
+			}
+		};
+		std::atomic<bool> flooding{ true };
+		for (std::size_t chain = 0; chain < smoke_threads; ++chain)
+		{
+			vault.post(repost{ &vault, &flooding });
+		}
+		for (std::size_t i = 0; i < 100; ++i)
+		{
+			auto ptr = vault.lock();
+			++*ptr;
+		}
+		flooding.store(false, std::memory_order_relaxed);
+		return check(!bad_future.load(), "delegating_vault: bad submit result")
+			&& check(propagated, "delegating_vault: exception not delivered through the future")
+			&& check(total == smoke_threads * smoke_iterations, "delegating_vault: lost post or submit");
+	}
+
+	// Eager, fire-and-forget coroutine: enough to drive lock_async and wait_async.
+	struct smoke_task
+	{
+		struct promise_type
+		{
+			smoke_task get_return_object() noexcept { return {}; }
+			std::suspend_never initial_suspend() noexcept { return {}; }
+			std::suspend_never final_suspend() noexcept { return {}; }
+			void return_void() noexcept {}
+			void unhandled_exception() noexcept { std::terminate(); }
+		};
+	};
+
+	smoke_task increment_async(cjm::synchro::async_mutex& mutex, std::size_t& counter, std::atomic<std::size_t>& done)
+	{
+		co_await mutex.lock_async();
+		++counter;
+		mutex.unlock();
+		done.fetch_add(1, std::memory_order_release);
+	}
+
+	smoke_task wait_for_flag_async(cjm::synchro::async_mutex& mutex, cjm::synchro::async_condition& condition,
+		const bool& flag, std::atomic<std::size_t>& woken)
+	{
+		co_await mutex.lock_async();
+		auto lck = std::unique_lock<cjm::synchro::async_mutex>{ mutex, std::adopt_lock };
+		co_await condition.wait_async(lck, [&flag] { return flag; });
+		woken.fetch_add(1, std::memory_order_release);
+	}
+
+	// Coroutines and blocking threads share one async_mutex; lock grants handed from thread to
+	// thread must neither be lost nor recurse without bound.
+	bool check_async()
+	{
+		cjm::synchro::async_mutex mutex{};
+		std::size_t counter = 0;
+		std::atomic<std::size_t> done{ 0 };
+		run_threads([&mutex, &counter, &done](std::size_t index)
+		{
+			for (std::size_t i = 0; i < smoke_iterations; ++i)
+			{
+				if (index % 2 == 0)
+				{
+					increment_async(mutex, counter, done);
+				}
+				else
+				{
+					auto lck = std::unique_lock<cjm::synchro::async_mutex>{ mutex };
+					++counter;
+					done.fetch_add(1, std::memory_order_release);
+				}
+			}
+		});
+		while (done.load(std::memory_order_acquire) != smoke_threads * smoke_iterations)
+		{
+			std::this_thread::yield();
+		}
+		bool passed = false;
+		{
+			auto lck = std::unique_lock<cjm::synchro::async_mutex>{ mutex };
+			passed = check(counter == smoke_threads * smoke_iterations, "async_mutex: lost increment");
+		}
+
+		cjm::synchro::async_condition condition{};
+		bool flag = false;
+		std::atomic<std::size_t> woken{ 0 };
+		run_threads([&](std::size_t)
+		{
+			for (std::size_t i = 0; i < smoke_iterations / 10; ++i)
+			{
+				wait_for_flag_async(mutex, condition, flag, woken);
+			}
+		});
+		std::thread{ [&]
+		{
+			{
+				auto lck = std::unique_lock<cjm::synchro::async_mutex>{ mutex };
+				flag = true;
+			}
+			condition.notify_all();
+		} }.join();
+		while (woken.load(std::memory_order_acquire) != smoke_threads * (smoke_iterations / 10))
+		{
+			std::this_thread::yield();
+		}
+		return check(woken.load() == smoke_threads * (smoke_iterations / 10), "async_condition: lost wake-up") && passed;
+	}
+
+	// Every way of obtaining the lock counts once: lock(), the try forms (which adopt the mutex
+	// they took), lock_all and combine.
+	bool check_stats()
+	{
+		using vault_t = cjm::synchro::synchro_vault<counted_record, std::shared_timed_mutex>;
+		vault_t vault{};
+		vault_t other{};
+		vault.set_stats_name("smoke.counted");
+		run_threads([&vault](std::size_t)
+		{
+			for (std::size_t i = 0; i < smoke_iterations; ++i)
+			{
+				auto ptr = vault.lock();
+				++ptr->value;
+			}
+		});
+		bool passed = check(static_cast<bool>(vault.try_lock()), "stats: try_lock failed");
+		passed = check(static_cast<bool>(vault.try_lock_for(std::chrono::milliseconds{ 1 })), "stats: try_lock_for failed") && passed;
+		passed = check(static_cast<bool>(vault.try_lock_shared()), "stats: try_lock_shared failed") && passed;
+		passed = check(static_cast<bool>(vault.try_lock_shared_for(std::chrono::milliseconds{ 1 })), "stats: try_lock_shared_for failed") && passed;
+		{
+			auto [mine, theirs] = cjm::synchro::lock_all(vault, cjm::synchro::as_shared(other));
+			++mine->value;
+		}
+		const std::uint64_t expected = smoke_threads * smoke_iterations + 5;
+		passed = check(vault.stats().acquisitions == expected, "stats: acquisitions do not match the lock count") && passed;
+		passed = check(other.stats().acquisitions == 1, "stats: lock_all acquisition not counted") && passed;
+
+		bool registered = false;
+		for (const auto& snapshot : cjm::synchro::stats_registry::instance().snapshot())
+		{
+			registered = registered || (snapshot.name == "smoke.counted" && snapshot.acquisitions == expected);
+		}
+		passed = check(registered, "stats: vault missing from stats_registry") && passed;
+
+		cjm::synchro::combining_vault<counted_record, std::shared_timed_mutex> combined{};
+		for (std::size_t i = 0; i < 100; ++i)
+		{
+			combined.combine([](counted_record& record) { ++record.value; });
+		}
+		return check(combined.stats().acquisitions == 100, "stats: combine acquisitions not counted") && passed;
+	}
+
+	// Holds are sampled, so a busy traced vault yields some hold events, fewer than its holds,
+	// all labelled with this file and the vault's name in the exported JSON.
+	bool check_trace()
+	{
+		auto& trace = cjm::synchro::lock_trace::instance();
+		trace.clear();
+		{
+			cjm::synchro::synchro_vault<traced_record> vault{};
+			vault.set_stats_name("smoke.traced");
+			run_threads([&vault](std::size_t)
+			{
+				for (std::size_t i = 0; i < smoke_iterations / 10; ++i)
+				{
+					auto ptr = vault.lock();
+					++ptr->value;
+				}
+			});
+		}
+		std::size_t holds = 0;
+		bool labelled = true;
+		for (const auto& event : trace.events())
+		{
+			if (event.kind == cjm::synchro::trace_event_kind::hold)
+			{
+				++holds;
+			}
+			labelled = labelled && event.vault_name != nullptr && *event.vault_name == "smoke.traced"
+				&& std::string_view{ event.file }.ends_with("cjm_synchro.cpp");
+		}
+		std::ostringstream json;
+		trace.flush_chrome_trace(json);
+		const std::string text = json.str();
+		return check(holds > 0 && holds < smoke_threads * (smoke_iterations / 10), "lock_trace: holds not sampled")
+			&& check(labelled, "lock_trace: event without the vault's name or call site")
+			&& check(text.starts_with("{\"displayTimeUnit\"") && text.find("\"hold cjm_synchro.cpp:") != std::string::npos
+				&& text.find("\"vault\":\"smoke.traced\"") != std::string::npos, "lock_trace: chrome trace export");
+	}
+
+	// Waiters with short timeouts race update(), which unlinks them under the lock and signals
+	// them after releasing it; then a predicate that throws inside update must leave every
+	// waiter registered.
+	bool check_keyed_vault()
+	{
+		constexpr std::size_t rounds = smoke_iterations / 10;
+		cjm::synchro::keyed_vault<std::array<std::size_t, smoke_threads>, std::size_t> vault{};
+		run_threads([&vault](std::size_t index)
+		{
+			for (std::size_t round = 1; round <= rounds; ++round)
+			{
+				if (index == 0)
+				{
+					for (std::size_t key = 1; key < smoke_threads; ++key)
+					{
+						vault.update(key, [key, round](auto& counts) { counts[key] = round; });
+					}
+				}
+				else
+				{
+					auto ptr = vault.lock();
+					while (!vault.wait_for(ptr, index, std::chrono::microseconds{ 20 },
+						[index, round](const auto& counts) { return counts[index] >= round; })) {}
+				}
+			}
+		});
+
+		// Only the notifier (this thread) sees the predicate throw; the waiter's own test does not.
+		const std::thread::id notifier = std::this_thread::get_id();
+		std::atomic<std::size_t> woken{ 0 };
+		auto wait_for_value = [&vault, &woken, notifier](std::size_t value, bool throw_on_one)
+		{
+			auto ptr = vault.lock();
+			vault.wait(ptr, 0, [value, throw_on_one, notifier](const auto& counts)
+			{
+				if (throw_on_one && counts[0] == 1 && std::this_thread::get_id() == notifier)
+				{
+					throw std::runtime_error{ "predicate" };
+				}
+				return counts[0] >= value;
+			});
+			woken.fetch_add(1, std::memory_order_relaxed);
+		};
+		std::thread plain{ wait_for_value, 1, false };
+		std::thread throwing{ wait_for_value, 2, true };
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+		bool threw = false;
+		try
+		{
+			vault.update(0, [](auto& counts) { counts[0] = 1; });
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		vault.update(0, [](auto& counts) { counts[0] = 2; });
+		plain.join();
+		throwing.join();
+		return check(threw, "keyed_vault: predicate exception not propagated by update")
+			&& check(woken.load() == 2, "keyed_vault: waiter lost after a predicate threw");
+	}
+
+	// Transfers between two vaults taken in opposite orders must neither deadlock nor lose a
+	// unit; a third vault taken shared alongside them only reads.
+	bool check_lock_all()
+	{
+		cjm::synchro::synchro_vault<int> left{ static_cast<int>(smoke_iterations) };
+		cjm::synchro::synchro_vault<int> right{ 0 };
+		cjm::synchro::synchro_vault<int, std::shared_mutex> audit{ 0 };
+		run_threads([&](std::size_t index)
+		{
+			for (std::size_t i = 0; i < smoke_iterations / 10; ++i)
+			{
+				if (index % 2 == 0)
+				{
+					auto [from, to, seen] = cjm::synchro::lock_all(left, right, cjm::synchro::as_shared(audit));
+					--*from;
+					++*to;
+				}
+				else
+				{
+					auto [from, to] = cjm::synchro::synchronize(right, left);
+					--*from;
+					++*to;
+				}
+			}
+		});
+		auto [l, r] = cjm::synchro::lock_all(left, right);
+		return check(*l + *r == static_cast<int>(smoke_iterations), "lock_all: transfer lost a unit")
+			&& check(*r == 0, "lock_all: unbalanced transfers");
+	}
+
+	struct seqlock_record
+	{
+		std::uint64_t fields[8]{};
+	};
+
+	// Writers fill every field with one value, field by field through a locked pointer or all at
+	// once through assign_locked_datum; optimistic readers must never see two values mixed.
+	bool check_seqlock()
+	{
+		cjm::synchro::synchro_vault<seqlock_record, std::mutex, cjm::synchro::concepts::mutex_level::seqlock> vault{};
+		std::atomic<bool> torn{ false };
+		run_threads([&vault, &torn](std::size_t index)
+		{
+			for (std::size_t i = 1; i <= smoke_iterations; ++i)
+			{
+				if (index == 0)
+				{
+					auto ptr = vault.lock();
+					for (auto& field : ptr->fields)
+					{
+						field = i;
+					}
+				}
+				else if (index == 1)
+				{
+					seqlock_record record;
+					std::fill(std::begin(record.fields), std::end(record.fields), smoke_iterations + i);
+					vault.assign_locked_datum(record);
+				}
+				else
+				{
+					const seqlock_record copy = vault.copy_locked_datum();
+					if (std::adjacent_find(std::begin(copy.fields), std::end(copy.fields), std::not_equal_to<>{}) != std::end(copy.fields))
+					{
+						torn.store(true, std::memory_order_relaxed);
+					}
+				}
+			}
+		});
+		return check(!torn.load(), "seqlock: reader saw a torn record");
+	}
+
+	// A token passed round the threads through a futex-policy vault: every hand-off relies on
+	// notify_all waking the one waiter whose turn it is.  A timed wait whose predicate never
+	// holds must return at its deadline, and a wait_policy::none vault has no wait at all.
+	bool check_wait_policies()
+	{
+		static_assert(!cjm::synchro::detail::waitable_v<silent_record, std::mutex, cjm::synchro::concepts::mutex_level::std_mutex>);
+		constexpr std::size_t rounds = smoke_iterations / 10;
+		cjm::synchro::synchro_vault<futex_record> vault{};
+		run_threads([&vault](std::size_t index)
+		{
+			for (std::size_t round = 0; round < rounds; ++round)
+			{
+				auto ptr = vault.lock();
+				ptr.wait([&ptr, index] { return ptr->token % smoke_threads == index; });
+				++ptr->token;
+				ptr.notify_all();
+			}
+		});
+
+		const auto timeout = std::chrono::milliseconds{ 5 };
+		const auto start = std::chrono::steady_clock::now();
+		{
+			auto ptr = vault.lock();
+			ptr.wait_for(timeout, [] { return false; });
+		}
+		const bool timed_out = std::chrono::steady_clock::now() - start >= timeout;
+
+		cjm::synchro::synchro_vault<silent_record> silent{};
+		{
+			auto ptr = silent.lock();
+			++ptr->value;
+		}
+		return check(vault.copy_locked_datum().token == smoke_threads * rounds, "futex wait policy: lost hand-off")
+			&& check(timed_out, "futex wait policy: timed wait returned early")
+			&& check(silent.copy_locked_datum().value == 1, "none wait policy: lock failed");
+	}
+
+	// While another thread holds the lock the timed forms must come back empty, no sooner than
+	// their timeout; an upgrade lock is compatible with shared holders but not with a writer.
+	bool check_timed_acquisition()
+	{
+		const auto timeout = std::chrono::milliseconds{ 5 };
+		cjm::synchro::synchro_vault<int, std::timed_mutex> vault{};
+		std::atomic<int> phase{ 0 };
+		std::thread holder{ [&vault, &phase]
+		{
+			auto ptr = vault.lock();
+			phase.store(1, std::memory_order_release);
+			while (phase.load(std::memory_order_acquire) != 2)
+			{
+				std::this_thread::yield();
+			}
+		} };
+		while (phase.load(std::memory_order_acquire) != 1)
+		{
+			std::this_thread::yield();
+		}
+		const auto start = std::chrono::steady_clock::now();
+		const bool refused = !vault.try_lock_for(timeout) && !vault.try_lock_until(std::chrono::steady_clock::now() + timeout)
+			&& !vault.try_lock();
+		const bool waited = std::chrono::steady_clock::now() - start >= 2 * timeout;
+		phase.store(2, std::memory_order_release);
+		holder.join();
+		bool passed = check(refused, "try_lock_for: contended lock acquired");
+		passed = check(waited, "try_lock_for: returned before its timeout") && passed;
+		passed = check(static_cast<bool>(vault.try_lock_for(timeout)), "try_lock_for: free lock refused") && passed;
+
+		cjm::synchro::synchro_vault<int, boost::upgrade_mutex> upgradable{};
+		{
+			auto reader = upgradable.lock_shared();
+			std::thread{ [&] { passed = check(static_cast<bool>(upgradable.try_lock_upgrade_for(timeout)),
+				"try_lock_upgrade_for: refused beside a shared holder") && passed; } }.join();
+		}
+		{
+			auto writer = upgradable.lock();
+			std::thread{ [&] { passed = check(!upgradable.try_lock_upgrade_for(timeout),
+				"try_lock_upgrade_for: acquired beside a writer") && passed; } }.join();
+		}
+		return passed;
+	}
+
+	// Producers push_n and consumers pop_n through a queue much smaller than the traffic, so
+	// both sides block and wake each other; every element must come out exactly once.
+	bool check_bounded_queue()
+	{
+		constexpr std::size_t per_producer = smoke_iterations;
+		cjm::synchro::bounded_queue<std::size_t> queue{ 16 };
+		std::atomic<std::size_t> popped_sum{ 0 };
+		std::atomic<std::size_t> popped_count{ 0 };
+		run_threads([&](std::size_t index)
+		{
+			if (index % 2 == 0)
+			{
+				std::vector<std::size_t> values(per_producer);
+				std::iota(values.begin(), values.end(), index * per_producer + 1);
+				for (std::size_t next = 0; next < values.size(); next += 7)
+				{
+					queue.push_n(values.begin() + static_cast<std::ptrdiff_t>(next), std::min<std::size_t>(7, values.size() - next));
+				}
+			}
+			else
+			{
+				std::vector<std::size_t> received(per_producer);
+				std::size_t count = 0;
+				while (count < per_producer)
+				{
+					count += queue.pop_n(received.begin() + static_cast<std::ptrdiff_t>(count), std::min<std::size_t>(5, per_producer - count));
+				}
+				popped_sum.fetch_add(std::accumulate(received.begin(), received.end(), std::size_t{ 0 }), std::memory_order_relaxed);
+				popped_count.fetch_add(count, std::memory_order_relaxed);
+			}
+		});
+		const std::size_t total = 2 * per_producer;
+		const std::size_t expected_sum = total * (total + 1) / 2 + per_producer * per_producer;
+
+		for (std::size_t i = 0; i < queue.capacity(); ++i)
+		{
+			queue.push(i);
+		}
+		const bool full_refused = !queue.try_push(std::size_t{ 0 });
+		std::size_t drained = 0;
+		while (queue.try_pop())
+		{
+			++drained;
+		}
+		const bool empty_timed_out = !queue.try_pop_for(std::chrono::milliseconds{ 1 });
+		return check(popped_count.load() == total && popped_sum.load() == expected_sum, "bounded_queue: push_n/pop_n lost or duplicated an element")
+			&& check(full_refused && drained == queue.capacity() && empty_timed_out, "bounded_queue: try_push/try_pop at the bounds");
+	}
+
+	// Each thread counts in its own element of a vault_array, which must start on a line of its
+	// own; an isolated_mutex vault is line-aligned and behaves like any other under contention.
+	bool check_layouts()
+	{
+		constexpr auto line = cjm::synchro::detail::cache_line_size;
+		cjm::synchro::vault_array<std::size_t, smoke_threads> vaults{};
+		cjm::synchro::synchro_vault<isolated_record> isolated{};
+		run_threads([&](std::size_t index)
+		{
+			for (std::size_t i = 0; i < smoke_iterations; ++i)
+			{
+				++*vaults.lock(index);
+				auto ptr = isolated.lock();
+				++ptr->value;
+			}
+		});
+		bool separate = true;
+		bool counted = true;
+		for (std::size_t index = 0; index < vaults.size(); ++index)
+		{
+			separate = separate && reinterpret_cast<std::uintptr_t>(&vaults[index]) % line == 0;
+			counted = counted && vaults[index].copy_locked_datum() == smoke_iterations;
+		}
+		return check(separate, "vault_array: element does not start on its own cache line")
+			&& check(counted, "vault_array: lost increment")
+			&& check(reinterpret_cast<std::uintptr_t>(&isolated) % line == 0, "layout_policy::isolated_mutex: vault not line-aligned")
+			&& check(isolated.copy_locked_datum().value == smoke_threads * smoke_iterations, "layout_policy::isolated_mutex: lost increment");
+	}
+}
+
+// Short threaded runs of the newer primitives; each failure is reported on std::cerr.
+bool run_smoke_checks()
+{
+	bool passed = check_distributed_shared_mutex();
+	passed = check_rcu() && passed;
+	passed = check_left_right() && passed;
+	passed = check_mcs<cjm::synchro::mcs_mutex>("mcs_mutex: lost increment") && passed;
+	passed = check_mcs<cjm::synchro::mcs_parking_mutex>("mcs_parking_mutex: lost increment") && passed;
+	passed = check_combining() && passed;
+	passed = check_delegating() && passed;
+	passed = check_async() && passed;
+	passed = check_keyed_vault() && passed;
+	passed = check_stats() && passed;
+	passed = check_trace() && passed;
+	passed = check_lock_all() && passed;
+	passed = check_seqlock() && passed;
+	passed = check_wait_policies() && passed;
+	passed = check_timed_acquisition() && passed;
+	passed = check_bounded_queue() && passed;
+	passed = check_layouts() && passed;
+	return passed;
+}
+
 
 
 // Run program: Ctrl + F5 or Debug > Start Without Debugging menu
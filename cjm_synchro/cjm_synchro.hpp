@@ -1,26 +1,480 @@
 #ifndef CJM_SYNCHRO_HPP_
 #define CJM_SYNCHRO_HPP_
 #include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro_trace.hpp"
+#include <tuple>
+#include <memory>
+#include <coroutine>
+#include <string>
 
 namespace cjm::synchro
 {
-	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	using detail::lock_release_notify;
+
+	namespace detail
+	{
+		struct vault_access;
+
+		template<typename TRequest, typename TMutexAwaiter>
+		class vault_lock_awaiter;
+
+		template<typename TMutex>
+		concept async_lockable = requires (TMutex & mutex) { mutex.lock_async(); };
+
+		template<typename TMutex>
+		concept async_shared_lockable = requires (TMutex & mutex) { mutex.lock_shared_async(); };
+	}
+
+	template<typename TLocked, concepts::mutex TMutex = std::mutex, concepts::mutex_level Level = concepts::level_v<TMutex>>
 	class locked_ptr;
 
-	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	template<typename TLocked, concepts::mutex TMutex = std::mutex, concepts::mutex_level Level = concepts::level_v<TMutex>>
+	class shared_locked_ptr;
+
+	template<typename TLocked, concepts::mutex TMutex = std::mutex, concepts::mutex_level Level = concepts::level_v<TMutex>>
+	class upgrade_locked_ptr;
+
+	template<typename TLocked, concepts::mutex TMutex = std::mutex, concepts::mutex_level Level = concepts::level_v<TMutex>>
 	class synchro_vault;
 
+	template<typename TVault>
+	struct shared_lock_request;
+
 	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
 	class locked_ptr : public detail::locked_ptr_base<TLocked, TMutex, Level>
 	{
+		using base_t = detail::locked_ptr_base<TLocked, TMutex, Level>;
 		using synchro_vault_t = synchro_vault<TLocked, TMutex, Level>;
-		friend class synchro_vault_t;
-		using ctrl_block
+		friend synchro_vault_t;
+		friend class upgrade_locked_ptr<TLocked, TMutex, Level>;
+		friend detail::vault_access;
 	public:
+		using locked_t = typename base_t::locked_t;
+		using scoped_unlock_t = typename base_t::scoped_unlock_t;
+		using call_site_t = typename base_t::call_site_t;
+		using shared_locked_ptr_t = shared_locked_ptr<TLocked, TMutex, Level>;
+		using upgrade_locked_ptr_t = upgrade_locked_ptr<TLocked, TMutex, Level>;
+
 		locked_ptr() = default;
+		locked_ptr(locked_ptr&& other) noexcept = default;
+		locked_ptr& operator=(locked_ptr&& other) noexcept = default;
+		~locked_ptr() = default;
+
+		[[nodiscard]] locked_t* operator->() const { return std::addressof(this->locked_value()); }
+		[[nodiscard]] locked_t& operator*() const { return this->locked_value(); }
+		[[nodiscard]] explicit operator bool() const noexcept { return this->is_locked_impl(); }
+
+		void notify_one() requires (detail::waitable_v<TLocked, TMutex, Level>) { this->notify_one_impl(); }
+		void notify_all() requires (detail::waitable_v<TLocked, TMutex, Level>) { this->notify_all_impl(); }
+		void set_release_notification(lock_release_notify lrn)
+			requires (base_t::release_notifier_t::policy == release_notify_policy::runtime)
+		{
+			this->set_cv_release_notification(lrn);
+		}
+
+		void wait() requires (detail::waitable_v<TLocked, TMutex, Level>) { this->wait_impl(); }
+		template<std::predicate Predicate>
+		void wait(Predicate p) requires (detail::waitable_v<TLocked, TMutex, Level>) { this->wait_impl(std::move(p)); }
+		template<concepts::duration Duration, std::predicate Predicate>
+		void wait_for(const Duration& d, Predicate p) requires (detail::waitable_v<TLocked, TMutex, Level>) { this->wait_for_impl(d, std::move(p)); }
+		template<concepts::time_point TimePoint, std::predicate Predicate>
+		void wait_until(const TimePoint& tp, Predicate p) requires (detail::waitable_v<TLocked, TMutex, Level>) { this->wait_until_impl(tp, std::move(p)); }
+		// co_await ptr.wait_async(pred): suspends instead of blocking; resumes holding the lock with pred() true.
+		template<std::predicate Predicate, typename... TExecutor>
+			requires (sizeof...(TExecutor) <= 1 && detail::async_waitable_condition<typename base_t::condition_variable_t,
+				typename base_t::lock_t, Predicate, TExecutor...>)
+		[[nodiscard]] auto wait_async(Predicate p, TExecutor&... executor)
+		{
+			return this->wait_async_impl(std::move(p), executor...);
+		}
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock(call_site_t site = call_site_t::current()) { return this->scoped_unlock_impl(site); }
+
+		[[nodiscard]] shared_locked_ptr_t downgrade() requires (Level == concepts::mutex_level::upgrade)
+		{
+			return shared_locked_ptr_t{ this->downgrade_to_shared_impl() };
+		}
+
+		[[nodiscard]] upgrade_locked_ptr_t downgrade_to_upgrade() requires (Level == concepts::mutex_level::upgrade)
+		{
+			return upgrade_locked_ptr_t{ this->downgrade_to_upgrade_impl() };
+		}
+
+	private:
+		explicit locked_ptr(base_t&& base) noexcept : base_t{ std::move(base) } {}
+	};
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class shared_locked_ptr : public detail::shared_locked_ptr_base<TLocked, TMutex, Level>
+	{
+		using base_t = detail::shared_locked_ptr_base<TLocked, TMutex, Level>;
+		using synchro_vault_t = synchro_vault<TLocked, TMutex, Level>;
+		friend synchro_vault_t;
+		friend class locked_ptr<TLocked, TMutex, Level>;
+		friend class upgrade_locked_ptr<TLocked, TMutex, Level>;
+		friend detail::vault_access;
+	public:
+		using locked_t = typename base_t::locked_t;
+		using const_locked_t = typename base_t::const_locked_t;
+		using scoped_unlock_t = typename base_t::scoped_unlock_t;
+		using call_site_t = typename base_t::call_site_t;
+
+		shared_locked_ptr() = default;
+		shared_locked_ptr(shared_locked_ptr&& other) noexcept = default;
+		shared_locked_ptr& operator=(shared_locked_ptr&& other) noexcept = default;
+		~shared_locked_ptr() = default;
+
+		[[nodiscard]] const_locked_t* operator->() const { return std::addressof(this->locked_value()); }
+		[[nodiscard]] const_locked_t& operator*() const { return this->locked_value(); }
+		[[nodiscard]] explicit operator bool() const noexcept { return this->is_locked_impl(); }
+
+		template<std::predicate Predicate>
+		void wait(Predicate p) requires (detail::waitable_v<TLocked, TMutex, Level>) { this->wait_impl(std::move(p)); }
+		template<concepts::duration Duration, std::predicate Predicate>
+		bool wait_for(const Duration& d, Predicate p) requires (detail::waitable_v<TLocked, TMutex, Level>) { return this->wait_for_impl(d, std::move(p)); }
+		template<concepts::time_point TimePoint, std::predicate Predicate>
+		bool wait_until(const TimePoint& tp, Predicate p) requires (detail::waitable_v<TLocked, TMutex, Level>) { return this->wait_until_impl(tp, std::move(p)); }
+		template<std::predicate Predicate, typename... TExecutor>
+			requires (sizeof...(TExecutor) <= 1 && detail::async_waitable_condition<typename base_t::condition_variable_t,
+				typename base_t::shared_lock_t, Predicate, TExecutor...>)
+		[[nodiscard]] auto wait_async(Predicate p, TExecutor&... executor)
+		{
+			return this->wait_async_impl(std::move(p), executor...);
+		}
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock(call_site_t site = call_site_t::current()) { return this->scoped_unlock_impl(site); }
+
+	private:
+		explicit shared_locked_ptr(base_t&& base) noexcept : base_t{ std::move(base) } {}
+	};
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class upgrade_locked_ptr : public detail::upgrade_locked_ptr_base<TLocked, TMutex, Level>
+	{
+		using base_t = detail::upgrade_locked_ptr_base<TLocked, TMutex, Level>;
+		using synchro_vault_t = synchro_vault<TLocked, TMutex, Level>;
+		friend synchro_vault_t;
+		friend class locked_ptr<TLocked, TMutex, Level>;
+		friend detail::vault_access;
+	public:
+		using locked_t = typename base_t::locked_t;
+		using const_locked_t = typename base_t::const_locked_t;
+		using scoped_unlock_t = typename base_t::scoped_unlock_t;
+		using call_site_t = typename base_t::call_site_t;
+		using locked_ptr_t = locked_ptr<TLocked, TMutex, Level>;
+		using shared_locked_ptr_t = shared_locked_ptr<TLocked, TMutex, Level>;
+
+		upgrade_locked_ptr() = default;
+		upgrade_locked_ptr(upgrade_locked_ptr&& other) noexcept = default;
+		upgrade_locked_ptr& operator=(upgrade_locked_ptr&& other) noexcept = default;
+		~upgrade_locked_ptr() = default;
+
+		[[nodiscard]] const_locked_t* operator->() const { return std::addressof(this->locked_value()); }
+		[[nodiscard]] const_locked_t& operator*() const { return this->locked_value(); }
+		[[nodiscard]] explicit operator bool() const noexcept { return this->is_locked_impl(); }
+
+		template<std::predicate Predicate>
+		void wait(Predicate p) requires (detail::waitable_v<TLocked, TMutex, Level>) { this->wait_impl(std::move(p)); }
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock(call_site_t site = call_site_t::current()) { return this->scoped_unlock_impl(site); }
+
+		[[nodiscard]] locked_ptr_t upgrade(call_site_t site = call_site_t::current()) { return locked_ptr_t{ this->upgrade_impl(site) }; }
+		[[nodiscard]] shared_locked_ptr_t downgrade() { return shared_locked_ptr_t{ this->downgrade_to_shared_impl() }; }
+
 	private:
-		explicit locked_ptr(ctrl_blck_ptr_t ptr)
+		explicit upgrade_locked_ptr(base_t&& base) noexcept : base_t{ std::move(base) } {}
 	};
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class synchro_vault : public detail::synchro_vault_base<TLocked, TMutex, Level>
+	{
+		using base_t = detail::synchro_vault_base<TLocked, TMutex, Level>;
+		friend detail::vault_access;
+	public:
+		using locked_t = std::remove_reference_t<TLocked>;
+		using mutex_t = TMutex;
+		static constexpr concepts::mutex_level level = Level;
+		using locked_ptr_t = locked_ptr<TLocked, TMutex, Level>;
+		using shared_locked_ptr_t = shared_locked_ptr<TLocked, TMutex, Level>;
+		using upgrade_locked_ptr_t = upgrade_locked_ptr<TLocked, TMutex, Level>;
+		// std::source_location when vault_traits declares stats = stats_policy::traced, otherwise an
+		// empty placeholder.  Leave it defaulted: it then names the caller in the lock trace.
+		using call_site_t = typename base_t::call_site_t;
+		static constexpr concepts::time_type exclusive_time = concepts::time_library_v<TMutex, concepts::mutex_level::basic>;
+		static constexpr concepts::time_type shared_time = concepts::time_library_v<TMutex, concepts::mutex_level::shared>;
+		static constexpr concepts::time_type upgrade_time = concepts::time_library_v<TMutex, concepts::mutex_level::upgrade>;
+
+		synchro_vault() noexcept(std::is_nothrow_default_constructible_v<locked_t>)
+			requires (std::is_default_constructible_v<locked_t>) : base_t{} {}
+		template<typename...TArgs>
+			requires (sizeof...(TArgs) > 0 && std::constructible_from<locked_t, TArgs...>)
+		explicit synchro_vault(TArgs&&... args) noexcept(cjm::concepts::nothrow_constructible_from<locked_t,
+			TArgs...>) : base_t{ std::forward<TArgs>(args)... } {}
+		synchro_vault(const synchro_vault& other) = delete;
+		synchro_vault(synchro_vault&& other) noexcept = delete;
+		synchro_vault& operator=(const synchro_vault& other) = delete;
+		synchro_vault& operator=(synchro_vault&& other) noexcept = delete;
+		~synchro_vault() = default;
+
+		[[nodiscard]] locked_ptr_t lock(call_site_t site = call_site_t::current()) { return locked_ptr_t{ this->lock_impl(site) }; }
+
+		[[nodiscard]] shared_locked_ptr_t lock_shared(call_site_t site = call_site_t::current()) const
+			requires (Level == concepts::mutex_level::shared || Level == concepts::mutex_level::upgrade)
+		{
+			return shared_locked_ptr_t{ this->lock_shared_impl(site) };
+		}
+
+		[[nodiscard]] upgrade_locked_ptr_t lock_upgrade(call_site_t site = call_site_t::current())
+			requires (Level == concepts::mutex_level::upgrade)
+		{
+			return upgrade_locked_ptr_t{ this->lock_upgrade_impl(site) };
+		}
+
+		// co_await vault.lock_async() yields a locked_ptr_t without blocking the thread.  Available
+		// when the mutex provides lock_async (e.g. async_mutex); pass an executor to resume the
+		// coroutine there rather than on the thread that released the lock.
+		template<typename... TExecutor>
+			requires (detail::async_lockable<TMutex> && sizeof...(TExecutor) <= 1)
+		[[nodiscard]] auto lock_async(TExecutor&... executor)
+		{
+			TMutex& mutex = *this->defer_lock_impl().mutex();
+			using awaiter_t = detail::vault_lock_awaiter<synchro_vault&, decltype(mutex.lock_async(executor...))>;
+			return awaiter_t{ *this, mutex.lock_async(executor...) };
+		}
+
+		template<typename... TExecutor>
+			requires (detail::async_shared_lockable<TMutex> && sizeof...(TExecutor) <= 1 &&
+				(Level == concepts::mutex_level::shared || Level == concepts::mutex_level::upgrade))
+		[[nodiscard]] auto lock_shared_async(TExecutor&... executor) const
+		{
+			TMutex& mutex = *this->defer_lock_shared_impl().mutex();
+			using awaiter_t = detail::vault_lock_awaiter<shared_lock_request<synchro_vault>, decltype(mutex.lock_shared_async(executor...))>;
+			return awaiter_t{ shared_lock_request<synchro_vault>{ this }, mutex.lock_shared_async(executor...) };
+		}
+
+		// Non-blocking and deadline-bounded acquisition: an empty pointer (operator bool false) means
+		// the lock was not obtained.  Durations and time points may come from std or boost chrono;
+		// they are converted at compile time to what the mutex accepts at that level.
+		[[nodiscard]] locked_ptr_t try_lock(call_site_t site = call_site_t::current())
+		{
+			return try_acquire<locked_ptr_t>(*this, this->defer_lock_impl(), [](TMutex& m) { return m.try_lock(); }, site);
+		}
+
+		template<concepts::duration Duration>
+			requires (exclusive_time != concepts::time_type::not_timed_or_unknown)
+		[[nodiscard]] locked_ptr_t try_lock_for(const Duration& d, call_site_t site = call_site_t::current())
+		{
+			const auto timeout = detail::to_mutex_duration<exclusive_time>(d);
+			return try_acquire<locked_ptr_t>(*this, this->defer_lock_impl(), [&](TMutex& m) { return m.try_lock_for(timeout); }, site);
+		}
+
+		template<concepts::time_point TimePoint>
+			requires (exclusive_time != concepts::time_type::not_timed_or_unknown)
+		[[nodiscard]] locked_ptr_t try_lock_until(const TimePoint& tp, call_site_t site = call_site_t::current())
+		{
+			const auto deadline = detail::to_mutex_deadline<exclusive_time>(tp);
+			return try_acquire<locked_ptr_t>(*this, this->defer_lock_impl(), [&](TMutex& m) { return m.try_lock_until(deadline); }, site);
+		}
+
+		[[nodiscard]] shared_locked_ptr_t try_lock_shared(call_site_t site = call_site_t::current()) const
+			requires (Level == concepts::mutex_level::shared || Level == concepts::mutex_level::upgrade)
+		{
+			return try_acquire<shared_locked_ptr_t>(*this, this->defer_lock_shared_impl(), [](TMutex& m) { return m.try_lock_shared(); }, site);
+		}
+
+		template<concepts::duration Duration>
+			requires ((Level == concepts::mutex_level::shared || Level == concepts::mutex_level::upgrade) &&
+				shared_time != concepts::time_type::not_timed_or_unknown)
+		[[nodiscard]] shared_locked_ptr_t try_lock_shared_for(const Duration& d, call_site_t site = call_site_t::current()) const
+		{
+			const auto timeout = detail::to_mutex_duration<shared_time>(d);
+			return try_acquire<shared_locked_ptr_t>(*this, this->defer_lock_shared_impl(), [&](TMutex& m) { return m.try_lock_shared_for(timeout); }, site);
+		}
+
+		template<concepts::time_point TimePoint>
+			requires ((Level == concepts::mutex_level::shared || Level == concepts::mutex_level::upgrade) &&
+				shared_time != concepts::time_type::not_timed_or_unknown)
+		[[nodiscard]] shared_locked_ptr_t try_lock_shared_until(const TimePoint& tp, call_site_t site = call_site_t::current()) const
+		{
+			const auto deadline = detail::to_mutex_deadline<shared_time>(tp);
+			return try_acquire<shared_locked_ptr_t>(*this, this->defer_lock_shared_impl(), [&](TMutex& m) { return m.try_lock_shared_until(deadline); }, site);
+		}
+
+		[[nodiscard]] upgrade_locked_ptr_t try_lock_upgrade(call_site_t site = call_site_t::current()) requires (Level == concepts::mutex_level::upgrade)
+		{
+			return try_acquire<upgrade_locked_ptr_t>(*this, this->defer_lock_upgrade_impl(), [](TMutex& m) { return m.try_lock_upgrade(); }, site);
+		}
+
+		template<concepts::duration Duration>
+			requires (Level == concepts::mutex_level::upgrade && upgrade_time != concepts::time_type::not_timed_or_unknown)
+		[[nodiscard]] upgrade_locked_ptr_t try_lock_upgrade_for(const Duration& d, call_site_t site = call_site_t::current())
+		{
+			const auto timeout = detail::to_mutex_duration<upgrade_time>(d);
+			return try_acquire<upgrade_locked_ptr_t>(*this, this->defer_lock_upgrade_impl(), [&](TMutex& m) { return m.try_lock_upgrade_for(timeout); }, site);
+		}
+
+		template<concepts::time_point TimePoint>
+			requires (Level == concepts::mutex_level::upgrade && upgrade_time != concepts::time_type::not_timed_or_unknown)
+		[[nodiscard]] upgrade_locked_ptr_t try_lock_upgrade_until(const TimePoint& tp, call_site_t site = call_site_t::current())
+		{
+			const auto deadline = detail::to_mutex_deadline<upgrade_time>(tp);
+			return try_acquire<upgrade_locked_ptr_t>(*this, this->defer_lock_upgrade_impl(), [&](TMutex& m) { return m.try_lock_upgrade_until(deadline); }, site);
+		}
+
+		void notify_one() requires (detail::waitable_v<TLocked, TMutex, Level>) { this->notify_one_impl(); }
+		void notify_all() requires (detail::waitable_v<TLocked, TMutex, Level>) { this->notify_all_impl(); }
+
+		// Present when vault_traits enables stats.  The name labels the vault in stats_registry.
+		void set_stats_name(std::string name) requires (detail::stats_enabled_v<TLocked, TMutex, Level>)
+		{
+			this->stats_impl().set_name(std::move(name));
+		}
+
+		[[nodiscard]] vault_stats_snapshot stats() const requires (detail::stats_enabled_v<TLocked, TMutex, Level>)
+		{
+			return this->stats_impl().snapshot();
+		}
+
+		using base_t::copy_locked_datum;
+		using base_t::release_locked_datum;
+		using base_t::swap_locked_datum;
+		using base_t::assign_locked_datum;
+
+	private:
+		// The timed calls go straight to the mutex: std::unique_lock::try_lock_for only accepts
+		// std::chrono arguments, and boost mutexes take boost::chrono ones.  adopt_lock_impl
+		// counts the acquisition in the vault's stats, as lock() would.
+		template<typename TPtr, typename TSelf, typename TLock, typename TAttempt>
+		static TPtr try_acquire(TSelf& self, TLock deferred, TAttempt attempt, const call_site_t& site)
+		{
+			TMutex& mutex = *deferred.mutex();
+			if (!attempt(mutex))
+			{
+				return TPtr{};
+			}
+			if constexpr (std::is_constructible_v<TLock, TMutex&, std::adopt_lock_t>)
+				return TPtr{ self.adopt_lock_impl(TLock{ mutex, std::adopt_lock }, site) };
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+			else
+				return TPtr{ self.adopt_lock_impl(TLock{ mutex, boost::adopt_lock }, site) };
+#endif
+		}
+	};
+
+	template<typename TVault>
+	struct shared_lock_request
+	{
+		const TVault* vault;
+	};
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+		requires (Level == concepts::mutex_level::shared || Level == concepts::mutex_level::upgrade)
+	[[nodiscard]] shared_lock_request<synchro_vault<TLocked, TMutex, Level>> as_shared(const synchro_vault<TLocked, TMutex, Level>& vault) noexcept
+	{
+		return shared_lock_request<synchro_vault<TLocked, TMutex, Level>>{ std::addressof(vault) };
+	}
+
+	namespace detail
+	{
+		struct vault_access
+		{
+			template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+			static auto defer(synchro_vault<TLocked, TMutex, Level>& vault)
+			{
+				return vault.defer_lock_impl();
+			}
+
+			template<typename TVault>
+			static auto defer(shared_lock_request<TVault> request)
+			{
+				return request.vault->defer_lock_shared_impl();
+			}
+
+			template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level, typename TLock>
+			static auto adopt(synchro_vault<TLocked, TMutex, Level>& vault, TLock&& lock)
+			{
+				return locked_ptr<TLocked, TMutex, Level>{ vault.adopt_lock_impl(std::forward<TLock>(lock)) };
+			}
+
+			template<typename TVault, typename TLock>
+			static auto adopt(shared_lock_request<TVault> request, TLock&& lock)
+			{
+				return typename TVault::shared_locked_ptr_t{ request.vault->adopt_lock_impl(std::forward<TLock>(lock)) };
+			}
+		};
+
+		// Forwards to the mutex's awaiter; once the mutex has been granted the coroutine receives
+		// the same pointer type lock() / lock_shared() would have returned.
+		template<typename TRequest, typename TMutexAwaiter>
+		class vault_lock_awaiter
+		{
+		public:
+			vault_lock_awaiter(TRequest request, TMutexAwaiter awaiter) noexcept
+				: m_request{ request }, m_awaiter{ std::move(awaiter) } {}
+
+			[[nodiscard]] bool await_ready() { return m_awaiter.await_ready(); }
+
+			template<typename TPromise>
+			decltype(auto) await_suspend(std::coroutine_handle<TPromise> handle)
+			{
+				return m_awaiter.await_suspend(handle);
+			}
+
+			[[nodiscard]] auto await_resume()
+			{
+				m_awaiter.await_resume();
+				auto deferred = vault_access::defer(m_request);
+				using lock_t = decltype(deferred);
+				return vault_access::adopt(m_request, lock_t{ *deferred.mutex(), std::adopt_lock });
+			}
+
+		private:
+			TRequest m_request;
+			TMutexAwaiter m_awaiter;
+		};
+
+		template<typename T>
+		struct is_lock_all_argument : std::false_type {};
+
+		template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+		struct is_lock_all_argument<synchro_vault<TLocked, TMutex, Level>> : std::true_type {};
+
+		template<typename TVault>
+		struct is_lock_all_argument<shared_lock_request<TVault>> : std::true_type {};
+
+		template<typename T>
+		concept lock_all_argument = is_lock_all_argument<std::remove_cvref_t<T>>::value;
+	}
+
+	// Acquires every vault (exclusively, or shared when wrapped with as_shared) without
+	// deadlocking against other threads doing the same in a different order.  Uses std::lock's
+	// lock-one / try-the-rest / back-off algorithm, so no global address ordering is required.
+	// The same vault must not appear more than once.
+	template<detail::lock_all_argument... TVaults>
+		requires (sizeof...(TVaults) > 0)
+	[[nodiscard]] auto lock_all(TVaults&&... vaults)
+	{
+		auto locks = std::make_tuple(detail::vault_access::defer(vaults)...);
+		if constexpr (sizeof...(TVaults) == 1)
+		{
+			std::get<0>(locks).lock();
+		}
+		else
+		{
+			std::apply([](auto&... lock) { std::lock(lock...); }, locks);
+		}
+		return [&]<std::size_t... Indices>(std::index_sequence<Indices...>)
+		{
+			return std::make_tuple(detail::vault_access::adopt(vaults, std::move(std::get<Indices>(locks)))...);
+		}(std::index_sequence_for<TVaults...>{});
+	}
+
+	template<detail::lock_all_argument... TVaults>
+		requires (sizeof...(TVaults) > 0)
+	[[nodiscard]] auto synchronize(TVaults&&... vaults)
+	{
+		return lock_all(std::forward<TVaults>(vaults)...);
+	}
 }
 
 
@@ -0,0 +1,199 @@
+#ifndef CJM_SYNCHRO_ADAPTIVE_MUTEX_HPP_
+#define CJM_SYNCHRO_ADAPTIVE_MUTEX_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro_parking_lot.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace cjm::synchro::detail
+{
+	// Per-mutex spin budget.  A spin that wins after n pause iterations pulls the budget towards
+	// 2n, so it tracks the hold times the mutex actually sees; a spin that runs out shrinks the
+	// budget so that mutexes with long critical sections stop burning cycles before parking.
+	class adaptive_spinner
+	{
+	public:
+		static constexpr std::uint32_t min_budget = 16;
+		static constexpr std::uint32_t max_budget = 4096;
+		static constexpr std::uint32_t max_backoff = 64;
+
+		template<std::predicate TTryAcquire>
+		bool spin(TTryAcquire try_acquire) noexcept
+		{
+			const std::uint32_t budget = m_budget.load(std::memory_order_relaxed);
+			std::uint32_t spent = 0;
+			for (std::uint32_t backoff = 1; spent < budget; backoff = std::min(backoff * 2, max_backoff))
+			{
+				for (std::uint32_t i = 0; i < backoff; ++i)
+				{
+					cpu_relax();
+				}
+				spent += backoff;
+				if (try_acquire())
+				{
+					adjust(budget, std::clamp(spent * 2, min_budget, max_budget));
+					return true;
+				}
+			}
+			adjust(budget, min_budget);
+			return false;
+		}
+
+		[[nodiscard]] std::uint32_t budget() const noexcept { return m_budget.load(std::memory_order_relaxed); }
+
+	private:
+		void adjust(std::uint32_t budget, std::uint32_t target) noexcept
+		{
+			const auto next = static_cast<std::int64_t>(budget) + (static_cast<std::int64_t>(target) - static_cast<std::int64_t>(budget)) / 8;
+			m_budget.store(static_cast<std::uint32_t>(std::clamp<std::int64_t>(next, min_budget, max_budget)), std::memory_order_relaxed);
+		}
+
+		std::atomic<std::uint32_t> m_budget{ 128 };
+	};
+}
+
+namespace cjm::synchro
+{
+	// Spin-then-park mutex for short critical sections.  The state word is the classic three-state
+	// futex lock (unlocked / locked / locked with sleepers); contended lockers first spin with
+	// exponential backoff for an adaptive budget and only then sleep in std::atomic::wait, which
+	// is a futex on Linux and WaitOnAddress on Windows.  Unlock only wakes when someone slept.
+	class adaptive_mutex
+	{
+	public:
+		adaptive_mutex() noexcept = default;
+		adaptive_mutex(const adaptive_mutex& other) = delete;
+		adaptive_mutex(adaptive_mutex&& other) noexcept = delete;
+		adaptive_mutex& operator=(const adaptive_mutex& other) = delete;
+		adaptive_mutex& operator=(adaptive_mutex&& other) noexcept = delete;
+		~adaptive_mutex() = default;
+
+		void lock()
+		{
+			std::uint32_t expected = unlocked;
+			if (!m_state.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed))
+			{
+				lock_slow();
+			}
+		}
+
+		[[nodiscard]] bool try_lock() noexcept
+		{
+			std::uint32_t expected = unlocked;
+			return m_state.load(std::memory_order_relaxed) == unlocked &&
+				m_state.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+
+		void unlock()
+		{
+			if (m_state.exchange(unlocked, std::memory_order_release) == contended)
+			{
+				m_state.notify_one();
+			}
+		}
+
+	private:
+		static constexpr std::uint32_t unlocked = 0;
+		static constexpr std::uint32_t locked = 1;
+		static constexpr std::uint32_t contended = 2;
+
+		void lock_slow()
+		{
+			if (m_spinner.spin([this] { return try_lock(); }))
+			{
+				return;
+			}
+			while (m_state.exchange(contended, std::memory_order_acquire) != unlocked)
+			{
+				m_state.wait(contended, std::memory_order_relaxed);
+			}
+		}
+
+		std::atomic<std::uint32_t> m_state{ unlocked };
+		detail::adaptive_spinner m_spinner;
+	};
+
+	// Timed flavour of adaptive_mutex.  std::atomic::wait has no deadline, so sleepers park on
+	// the state word through the parking lot instead; the fast paths are identical.
+	class adaptive_timed_mutex
+	{
+	public:
+		adaptive_timed_mutex() noexcept = default;
+		adaptive_timed_mutex(const adaptive_timed_mutex& other) = delete;
+		adaptive_timed_mutex(adaptive_timed_mutex&& other) noexcept = delete;
+		adaptive_timed_mutex& operator=(const adaptive_timed_mutex& other) = delete;
+		adaptive_timed_mutex& operator=(adaptive_timed_mutex&& other) noexcept = delete;
+		~adaptive_timed_mutex() = default;
+
+		void lock()
+		{
+			std::uint32_t expected = unlocked;
+			if (!m_state.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed))
+			{
+				lock_slow(std::optional<std::chrono::steady_clock::time_point>{});
+			}
+		}
+
+		[[nodiscard]] bool try_lock() noexcept
+		{
+			std::uint32_t expected = unlocked;
+			return m_state.load(std::memory_order_relaxed) == unlocked &&
+				m_state.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+
+		template<typename TRep, typename TPeriod>
+		[[nodiscard]] bool try_lock_for(const std::chrono::duration<TRep, TPeriod>& duration)
+		{
+			return try_lock_until(std::chrono::steady_clock::now() + duration);
+		}
+
+		template<typename TClock, typename TDuration>
+		[[nodiscard]] bool try_lock_until(const std::chrono::time_point<TClock, TDuration>& deadline)
+		{
+			return try_lock() || lock_slow(std::optional<std::chrono::time_point<TClock, TDuration>>{ deadline });
+		}
+
+		void unlock()
+		{
+			if (m_state.exchange(unlocked, std::memory_order_release) == contended)
+			{
+				detail::parking_lot::unpark_one(&m_state, [](detail::parking_lot::unpark_result) {});
+			}
+		}
+
+	private:
+		static constexpr std::uint32_t unlocked = 0;
+		static constexpr std::uint32_t locked = 1;
+		static constexpr std::uint32_t contended = 2;
+
+		template<typename TTimePoint>
+		bool lock_slow(const std::optional<TTimePoint>& deadline)
+		{
+			if (m_spinner.spin([this] { return try_lock(); }))
+			{
+				return true;
+			}
+			while (m_state.exchange(contended, std::memory_order_acquire) != unlocked)
+			{
+				const auto validate = [this] { return m_state.load(std::memory_order_relaxed) == contended; };
+				if (!deadline.has_value())
+				{
+					detail::parking_lot::park(&m_state, validate, [] {});
+				}
+				else if (detail::parking_lot::park_until(&m_state, validate, [] {}, *deadline) == detail::parking_lot::park_result::timed_out)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		std::atomic<std::uint32_t> m_state{ unlocked };
+		detail::adaptive_spinner m_spinner;
+	};
+}
+#endif
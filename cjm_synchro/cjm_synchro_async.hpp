@@ -0,0 +1,649 @@
+#ifndef CJM_SYNCHRO_ASYNC_HPP_
+#define CJM_SYNCHRO_ASYNC_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro_parking_lot.hpp"
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+namespace cjm::synchro
+{
+	template<typename TExecutor>
+	concept async_executor = requires (TExecutor & executor, std::coroutine_handle<> handle)
+	{
+		{ executor.schedule(handle) };
+	};
+
+	// Resumes the coroutine on the thread that released the lock, once that thread has finished
+	// resuming any waiter it granted earlier (see detail::grant_dispatcher).
+	struct inline_executor
+	{
+		void schedule(std::coroutine_handle<> handle) const { handle.resume(); }
+
+		[[nodiscard]] static inline_executor& instance() noexcept
+		{
+			static inline_executor executor;
+			return executor;
+		}
+	};
+
+	class async_condition;
+}
+
+namespace cjm::synchro::detail
+{
+	enum class async_lock_mode : std::uint8_t
+	{
+		exclusive,
+		shared
+	};
+
+	// Intrusive queue node.  Blocked threads and suspended coroutines both wait as one of
+	// these; whoever releases the lock grants it to the node and then calls on_acquire.
+	class async_lock_core;
+
+	struct async_waiter
+	{
+		using acquire_fn_t = void (*)(async_waiter*) noexcept;
+
+		async_waiter(async_lock_mode mode, acquire_fn_t on_acquire) noexcept : mode{ mode }, on_acquire{ on_acquire } {}
+
+		async_waiter* next{ nullptr };
+		async_lock_mode mode;
+		acquire_fn_t on_acquire;
+		// Set by condition waiters: the mutex a notification re-queues them on.
+		async_lock_core* morph_target{ nullptr };
+	};
+
+	// Runs on_acquire for waiters that have been granted the lock.  A coroutine resumed inline
+	// can unlock straight away, which grants the next waiter from inside on_acquire; nesting
+	// there would cost one stack frame per queued waiter.  Instead, grants made while this
+	// thread is already dispatching are appended to its queue and run by the outermost call
+	// once the current on_acquire returns, so the stack stays flat however long the queue is.
+	// Consequently a coroutine resumed inline must not block its thread on a lock it has just
+	// handed to a waiter queued behind it: that waiter runs only after it returns or suspends.
+	class grant_dispatcher
+	{
+	public:
+		// granted is a chain linked through next and terminated by nullptr.
+		static void dispatch(async_waiter* granted) noexcept
+		{
+			grant_dispatcher& self = local();
+			self.append(granted);
+			if (self.m_running)
+			{
+				return;
+			}
+			self.m_running = true;
+			while (self.m_head != nullptr)
+			{
+				async_waiter* waiter = self.m_head;
+				self.m_head = waiter->next;
+				if (self.m_head == nullptr)
+				{
+					self.m_tail = nullptr;
+				}
+				waiter->next = nullptr;
+				waiter->on_acquire(waiter);
+			}
+			self.m_running = false;
+		}
+
+	private:
+		static grant_dispatcher& local() noexcept
+		{
+			thread_local grant_dispatcher dispatcher;
+			return dispatcher;
+		}
+
+		void append(async_waiter* chain) noexcept
+		{
+			if (chain == nullptr)
+			{
+				return;
+			}
+			(m_tail == nullptr ? m_head : m_tail->next) = chain;
+			m_tail = chain;
+			while (m_tail->next != nullptr)
+			{
+				m_tail = m_tail->next;
+			}
+		}
+
+		async_waiter* m_head{ nullptr };
+		async_waiter* m_tail{ nullptr };
+		bool m_running{ false };
+	};
+
+	// Lock state shared by async_mutex and async_shared_mutex.  A short internal guard protects
+	// the counts and a FIFO of waiters; release hands the lock directly to the next waiter(s),
+	// so a woken thread or coroutine never has to compete for it again.
+	class async_lock_core
+	{
+	public:
+		async_lock_core() noexcept = default;
+		async_lock_core(const async_lock_core& other) = delete;
+		async_lock_core(async_lock_core&& other) noexcept = delete;
+		async_lock_core& operator=(const async_lock_core& other) = delete;
+		async_lock_core& operator=(async_lock_core&& other) noexcept = delete;
+		~async_lock_core() = default;
+
+		[[nodiscard]] bool try_acquire(async_lock_mode mode) noexcept
+		{
+			auto lck = std::unique_lock<byte_mutex>{ m_guard };
+			return try_acquire_locked(mode);
+		}
+
+		// Returns true if the lock was taken immediately; otherwise the waiter is queued and its
+		// on_acquire runs, possibly on another thread, once the lock has been granted to it.
+		[[nodiscard]] bool acquire_or_enqueue(async_waiter& waiter) noexcept
+		{
+			auto lck = std::unique_lock<byte_mutex>{ m_guard };
+			if (try_acquire_locked(waiter.mode))
+			{
+				return true;
+			}
+			waiter.next = nullptr;
+			(m_tail == nullptr ? m_head : m_tail->next) = &waiter;
+			m_tail = &waiter;
+			return false;
+		}
+
+		void release(async_lock_mode mode) noexcept
+		{
+			async_waiter* granted = nullptr;
+			{
+				auto lck = std::unique_lock<byte_mutex>{ m_guard };
+				if (mode == async_lock_mode::exclusive)
+				{
+					assert(m_writer && m_readers == 0);
+					m_writer = false;
+				}
+				else
+				{
+					assert(!m_writer && m_readers > 0);
+					--m_readers;
+				}
+				granted = grant_locked();
+			}
+			grant_dispatcher::dispatch(granted);
+		}
+
+	private:
+		bool try_acquire_locked(async_lock_mode mode) noexcept
+		{
+			if (m_writer || m_head != nullptr)
+			{
+				return false;
+			}
+			if (mode == async_lock_mode::shared)
+			{
+				++m_readers;
+				return true;
+			}
+			if (m_readers == 0)
+			{
+				m_writer = true;
+				return true;
+			}
+			return false;
+		}
+
+		async_waiter* grant_locked() noexcept
+		{
+			async_waiter* granted_head = nullptr;
+			async_waiter* granted_tail = nullptr;
+			while (m_head != nullptr && !m_writer)
+			{
+				async_waiter* waiter = m_head;
+				if (waiter->mode == async_lock_mode::exclusive)
+				{
+					if (m_readers != 0 || granted_head != nullptr)
+					{
+						break;
+					}
+					m_writer = true;
+				}
+				else
+				{
+					++m_readers;
+				}
+				m_head = waiter->next;
+				if (m_head == nullptr)
+				{
+					m_tail = nullptr;
+				}
+				waiter->next = nullptr;
+				(granted_tail == nullptr ? granted_head : granted_tail->next) = waiter;
+				granted_tail = waiter;
+			}
+			return granted_head;
+		}
+
+		byte_mutex m_guard;
+		bool m_writer{ false };
+		std::uint32_t m_readers{ 0 };
+		async_waiter* m_head{ nullptr };
+		async_waiter* m_tail{ nullptr };
+	};
+
+	class blocking_waiter final : public async_waiter
+	{
+	public:
+		explicit blocking_waiter(async_lock_mode mode) noexcept : async_waiter{ mode, &granted } {}
+
+		void wait() noexcept
+		{
+			for (unsigned spins = 0; spins < 64 && !m_granted.load(std::memory_order_acquire); ++spins)
+			{
+				cpu_relax();
+			}
+			while (!m_granted.load(std::memory_order_acquire))
+			{
+				parking_lot::park(this, [this] { return !m_granted.load(std::memory_order_relaxed); }, [] {});
+			}
+		}
+
+	private:
+		// The waiter may return the moment it sees the flag; the parking lot only uses the
+		// address as a key, so unparking afterwards is at worst a spurious wakeup.
+		static void granted(async_waiter* waiter) noexcept
+		{
+			auto* self = static_cast<blocking_waiter*>(waiter);
+			self->m_granted.store(true, std::memory_order_release);
+			parking_lot::unpark_one(self, [](parking_lot::unpark_result) {});
+		}
+
+		std::atomic<bool> m_granted{ false };
+	};
+
+	template<async_executor TExecutor>
+	class lock_awaiter final : public async_waiter
+	{
+	public:
+		lock_awaiter(async_lock_core& core, async_lock_mode mode, TExecutor& executor) noexcept
+			: async_waiter{ mode, &granted }, m_core{ &core }, m_executor{ &executor } {}
+		lock_awaiter(const lock_awaiter& other) noexcept
+			: async_waiter{ other.mode, &granted }, m_core{ other.m_core }, m_executor{ other.m_executor } {}
+		lock_awaiter& operator=(const lock_awaiter& other) = delete;
+		~lock_awaiter() = default;
+
+		[[nodiscard]] bool await_ready() noexcept
+		{
+			return m_core->try_acquire(mode);
+		}
+
+		bool await_suspend(std::coroutine_handle<> handle) noexcept
+		{
+			m_handle = handle;
+			return !m_core->acquire_or_enqueue(*this);
+		}
+
+		void await_resume() const noexcept {}
+
+	private:
+		static void granted(async_waiter* waiter) noexcept
+		{
+			auto* self = static_cast<lock_awaiter*>(waiter);
+			self->m_executor->schedule(self->m_handle);
+		}
+
+		async_lock_core* m_core;
+		TExecutor* m_executor;
+		std::coroutine_handle<> m_handle{};
+	};
+
+	template<typename TMutex>
+	concept async_core_mutex = requires (TMutex & mutex)
+	{
+		{ mutex.async_core() } -> std::same_as<async_lock_core&>;
+	};
+}
+
+namespace cjm::synchro
+{
+	// Mutex that can be acquired by blocking (it satisfies concepts::mutex and can be the TMutex
+	// of any vault) or by co_await lock_async(), which suspends the coroutine instead of the
+	// thread.  Waiters of both kinds share one FIFO and the lock is handed to them directly.
+	class async_mutex
+	{
+	public:
+		using condition_variable_type = async_condition;
+
+		async_mutex() noexcept = default;
+		async_mutex(const async_mutex& other) = delete;
+		async_mutex(async_mutex&& other) noexcept = delete;
+		async_mutex& operator=(const async_mutex& other) = delete;
+		async_mutex& operator=(async_mutex&& other) noexcept = delete;
+		~async_mutex() = default;
+
+		void lock()
+		{
+			auto waiter = detail::blocking_waiter{ detail::async_lock_mode::exclusive };
+			if (!m_core.acquire_or_enqueue(waiter))
+			{
+				waiter.wait();
+			}
+		}
+
+		[[nodiscard]] bool try_lock() noexcept { return m_core.try_acquire(detail::async_lock_mode::exclusive); }
+
+		void unlock() noexcept { m_core.release(detail::async_lock_mode::exclusive); }
+
+		[[nodiscard]] detail::lock_awaiter<inline_executor> lock_async() noexcept
+		{
+			return lock_async(inline_executor::instance());
+		}
+
+		template<async_executor TExecutor>
+		[[nodiscard]] detail::lock_awaiter<TExecutor> lock_async(TExecutor& executor) noexcept
+		{
+			return detail::lock_awaiter<TExecutor>{ m_core, detail::async_lock_mode::exclusive, executor };
+		}
+
+		[[nodiscard]] detail::async_lock_core& async_core() noexcept { return m_core; }
+
+	private:
+		detail::async_lock_core m_core;
+	};
+
+	// Reader-writer flavour of async_mutex.  Queued requests are served in arrival order, so a
+	// waiting writer holds back readers that arrive after it.
+	class async_shared_mutex
+	{
+	public:
+		using condition_variable_type = async_condition;
+
+		async_shared_mutex() noexcept = default;
+		async_shared_mutex(const async_shared_mutex& other) = delete;
+		async_shared_mutex(async_shared_mutex&& other) noexcept = delete;
+		async_shared_mutex& operator=(const async_shared_mutex& other) = delete;
+		async_shared_mutex& operator=(async_shared_mutex&& other) noexcept = delete;
+		~async_shared_mutex() = default;
+
+		void lock()
+		{
+			auto waiter = detail::blocking_waiter{ detail::async_lock_mode::exclusive };
+			if (!m_core.acquire_or_enqueue(waiter))
+			{
+				waiter.wait();
+			}
+		}
+
+		[[nodiscard]] bool try_lock() noexcept { return m_core.try_acquire(detail::async_lock_mode::exclusive); }
+
+		void unlock() noexcept { m_core.release(detail::async_lock_mode::exclusive); }
+
+		void lock_shared()
+		{
+			auto waiter = detail::blocking_waiter{ detail::async_lock_mode::shared };
+			if (!m_core.acquire_or_enqueue(waiter))
+			{
+				waiter.wait();
+			}
+		}
+
+		[[nodiscard]] bool try_lock_shared() noexcept { return m_core.try_acquire(detail::async_lock_mode::shared); }
+
+		void unlock_shared() noexcept { m_core.release(detail::async_lock_mode::shared); }
+
+		[[nodiscard]] detail::lock_awaiter<inline_executor> lock_async() noexcept
+		{
+			return lock_async(inline_executor::instance());
+		}
+
+		template<async_executor TExecutor>
+		[[nodiscard]] detail::lock_awaiter<TExecutor> lock_async(TExecutor& executor) noexcept
+		{
+			return detail::lock_awaiter<TExecutor>{ m_core, detail::async_lock_mode::exclusive, executor };
+		}
+
+		[[nodiscard]] detail::lock_awaiter<inline_executor> lock_shared_async() noexcept
+		{
+			return lock_shared_async(inline_executor::instance());
+		}
+
+		template<async_executor TExecutor>
+		[[nodiscard]] detail::lock_awaiter<TExecutor> lock_shared_async(TExecutor& executor) noexcept
+		{
+			return detail::lock_awaiter<TExecutor>{ m_core, detail::async_lock_mode::shared, executor };
+		}
+
+		[[nodiscard]] detail::async_lock_core& async_core() noexcept { return m_core; }
+
+	private:
+		detail::async_lock_core m_core;
+	};
+}
+
+namespace cjm::synchro::detail
+{
+	// One co_await of async_condition::wait_async.  The awaiting coroutine's lock is released
+	// when it suspends; a notification moves the waiter straight onto the mutex's queue (wait
+	// morphing), and once the mutex is granted the predicate is checked by the granting thread
+	// while the lock is held on the waiter's behalf.  Only a satisfied predicate resumes it.
+	template<typename TLock, std::predicate TPredicate, async_executor TExecutor>
+	class condition_awaiter final : public async_waiter
+	{
+	public:
+		condition_awaiter(async_condition& condition, TLock& lock, TPredicate predicate, TExecutor& executor)
+			: async_waiter{ lock_mode, &granted }, m_condition{ &condition }, m_lock{ &lock },
+			m_mutex{ lock.mutex() }, m_predicate{ std::move(predicate) }, m_executor{ &executor }
+		{
+			assert(lock.owns_lock());
+			morph_target = &m_mutex->async_core();
+		}
+		condition_awaiter(const condition_awaiter& other) = delete;
+		condition_awaiter& operator=(const condition_awaiter& other) = delete;
+		~condition_awaiter() = default;
+
+		[[nodiscard]] bool await_ready() { return m_predicate(); }
+
+		bool await_suspend(std::coroutine_handle<> handle) noexcept;
+
+		void await_resume() const noexcept
+		{
+			assert(m_lock->owns_lock());
+		}
+
+	private:
+		static constexpr async_lock_mode lock_mode = std::is_same_v<TLock, std::unique_lock<typename TLock::mutex_type>>
+			? async_lock_mode::exclusive : async_lock_mode::shared;
+
+		enum class state : std::uint8_t
+		{
+			suspending,
+			suspended,
+			granted_while_suspending
+		};
+
+		static void granted(async_waiter* waiter) noexcept;
+
+		async_condition* m_condition;
+		TLock* m_lock;
+		typename TLock::mutex_type* m_mutex;
+		TPredicate m_predicate;
+		TExecutor* m_executor;
+		std::coroutine_handle<> m_handle{};
+		std::atomic<state> m_state{ state::suspending };
+	};
+}
+
+namespace cjm::synchro
+{
+	// Condition variable for async_mutex / async_shared_mutex, and what their vaults' ctrl_block
+	// uses.  Blocking waits behave like any condition variable; coroutines use wait_async, which
+	// never blocks a thread.  Notifying is allowed with or without the mutex held.
+	class async_condition
+	{
+		template<typename TLock, std::predicate TPredicate, async_executor TExecutor>
+		friend class detail::condition_awaiter;
+	public:
+		async_condition() noexcept = default;
+		async_condition(const async_condition& other) = delete;
+		async_condition(async_condition&& other) noexcept = delete;
+		async_condition& operator=(const async_condition& other) = delete;
+		async_condition& operator=(async_condition&& other) noexcept = delete;
+		~async_condition() = default;
+
+		void notify_one() noexcept
+		{
+			detail::async_waiter* waiter = nullptr;
+			{
+				auto lck = std::unique_lock<byte_mutex>{ m_guard };
+				waiter = m_head;
+				if (waiter != nullptr)
+				{
+					m_head = waiter->next;
+					if (m_head == nullptr)
+					{
+						m_tail = nullptr;
+					}
+				}
+			}
+			if (waiter != nullptr)
+			{
+				morph(waiter);
+			}
+			else
+			{
+				m_threads.notify_one();
+			}
+		}
+
+		void notify_all() noexcept
+		{
+			detail::async_waiter* waiter = nullptr;
+			{
+				auto lck = std::unique_lock<byte_mutex>{ m_guard };
+				waiter = std::exchange(m_head, nullptr);
+				m_tail = nullptr;
+			}
+			while (waiter != nullptr)
+			{
+				detail::async_waiter* next = waiter->next;
+				morph(waiter);
+				waiter = next;
+			}
+			m_threads.notify_all();
+		}
+
+		template<concepts::basic_lockable TLock>
+		void wait(TLock& lock) { m_threads.wait(lock); }
+
+		template<concepts::basic_lockable TLock, std::predicate TPredicate>
+		void wait(TLock& lock, TPredicate predicate) { m_threads.wait(lock, std::move(predicate)); }
+
+		template<concepts::basic_lockable TLock, typename TClock, typename TDuration>
+		std::cv_status wait_until(TLock& lock, const std::chrono::time_point<TClock, TDuration>& deadline)
+		{
+			return m_threads.wait_until(lock, deadline);
+		}
+
+		template<concepts::basic_lockable TLock, typename TClock, typename TDuration, std::predicate TPredicate>
+		bool wait_until(TLock& lock, const std::chrono::time_point<TClock, TDuration>& deadline, TPredicate predicate)
+		{
+			return m_threads.wait_until(lock, deadline, std::move(predicate));
+		}
+
+		template<concepts::basic_lockable TLock, typename TRep, typename TPeriod>
+		std::cv_status wait_for(TLock& lock, const std::chrono::duration<TRep, TPeriod>& duration)
+		{
+			return m_threads.wait_for(lock, duration);
+		}
+
+		template<concepts::basic_lockable TLock, typename TRep, typename TPeriod, std::predicate TPredicate>
+		bool wait_for(TLock& lock, const std::chrono::duration<TRep, TPeriod>& duration, TPredicate predicate)
+		{
+			return m_threads.wait_for(lock, duration, std::move(predicate));
+		}
+
+		// co_await wait_async(lock, pred) resumes with lock re-acquired and pred() true.  lock must
+		// be a std::unique_lock or std::shared_lock owning an async_mutex / async_shared_mutex.
+		template<typename TLock, std::predicate TPredicate>
+			requires (detail::async_core_mutex<typename TLock::mutex_type>)
+		[[nodiscard]] auto wait_async(TLock& lock, TPredicate predicate)
+		{
+			return wait_async(lock, std::move(predicate), inline_executor::instance());
+		}
+
+		template<typename TLock, std::predicate TPredicate, async_executor TExecutor>
+			requires (detail::async_core_mutex<typename TLock::mutex_type>)
+		[[nodiscard]] auto wait_async(TLock& lock, TPredicate predicate, TExecutor& executor)
+		{
+			return detail::condition_awaiter<TLock, TPredicate, TExecutor>{ *this, lock, std::move(predicate), executor };
+		}
+
+	private:
+		void enqueue(detail::async_waiter* waiter) noexcept
+		{
+			auto lck = std::unique_lock<byte_mutex>{ m_guard };
+			waiter->next = nullptr;
+			(m_tail == nullptr ? m_head : m_tail->next) = waiter;
+			m_tail = waiter;
+		}
+
+		static void morph(detail::async_waiter* waiter) noexcept;
+
+		byte_mutex m_guard;
+		detail::async_waiter* m_head{ nullptr };
+		detail::async_waiter* m_tail{ nullptr };
+		parking_condition m_threads;
+	};
+}
+
+namespace cjm::synchro::detail
+{
+	template<typename TLock, std::predicate TPredicate, async_executor TExecutor>
+	bool condition_awaiter<TLock, TPredicate, TExecutor>::await_suspend(std::coroutine_handle<> handle) noexcept
+	{
+		m_handle = handle;
+		m_condition->enqueue(this);
+		m_lock->release();
+		morph_target->release(lock_mode);
+		auto expected = state::suspending;
+		return m_state.compare_exchange_strong(expected, state::suspended, std::memory_order_acq_rel);
+	}
+
+	template<typename TLock, std::predicate TPredicate, async_executor TExecutor>
+	void condition_awaiter<TLock, TPredicate, TExecutor>::granted(async_waiter* waiter) noexcept
+	{
+		auto* self = static_cast<condition_awaiter*>(waiter);
+		*self->m_lock = TLock{ *self->m_mutex, std::adopt_lock };
+		if (!self->m_predicate())
+		{
+			self->m_lock->release();
+			self->m_condition->enqueue(self);
+			self->morph_target->release(lock_mode);
+			return;
+		}
+		auto expected = state::suspending;
+		if (self->m_state.compare_exchange_strong(expected, state::granted_while_suspending, std::memory_order_acq_rel))
+		{
+			return;
+		}
+		self->m_executor->schedule(self->m_handle);
+	}
+}
+
+namespace cjm::synchro
+{
+	// A notified coroutine is re-queued on its mutex rather than resumed; if the mutex is free
+	// it is granted on the spot.
+	inline void async_condition::morph(detail::async_waiter* waiter) noexcept
+	{
+		if (waiter->morph_target->acquire_or_enqueue(*waiter))
+		{
+			waiter->next = nullptr;
+			detail::grant_dispatcher::dispatch(waiter);
+		}
+	}
+}
+#endif
@@ -0,0 +1,120 @@
+#ifndef CJM_SYNCHRO_ATOMIC_VAULT_HPP_
+#define CJM_SYNCHRO_ATOMIC_VAULT_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro.hpp"
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace cjm::synchro
+{
+	// A payload a single std::atomic can hold without a lock.  Compare-exchange and
+	// std::atomic::wait compare object representations, so padding bits are excluded;
+	// floating point is allowed since its representation is fully significant.
+	template<typename TLocked>
+	concept lock_free_payload = !std::is_reference_v<TLocked> && std::is_trivially_copyable_v<TLocked>
+		&& (std::has_unique_object_representations_v<TLocked> || std::is_floating_point_v<TLocked>)
+		&& std::atomic<TLocked>::is_always_lock_free;
+
+	// Vault for small trivially copyable values: the value lives in one lock-free std::atomic,
+	// with no mutex or condition variable.  The datum members of synchro_vault
+	// (copy/release/swap/assign_locked_datum) and notify_one/notify_all keep their signatures;
+	// modify(fn) replaces lock() for read-modify-write, and wait(pred) sleeps in
+	// std::atomic::wait.  There is no lock(): nothing can hold a reference into the value.
+	template<lock_free_payload TLocked>
+	class atomic_vault
+	{
+	public:
+		using locked_t = TLocked;
+
+		atomic_vault() noexcept requires (std::is_default_constructible_v<locked_t>) : m_value{ locked_t{} } {}
+		explicit atomic_vault(const locked_t& value) noexcept : m_value{ value } {}
+		template<typename...TArgs>
+			requires (sizeof...(TArgs) > 1 && std::constructible_from<locked_t, TArgs...>)
+		explicit atomic_vault(TArgs&&... args) noexcept(cjm::concepts::nothrow_constructible_from<locked_t, TArgs...>)
+			: m_value{ locked_t(std::forward<TArgs>(args)...) } {}
+		atomic_vault(const atomic_vault& other) = delete;
+		atomic_vault(atomic_vault&& other) noexcept = delete;
+		atomic_vault& operator=(const atomic_vault& other) = delete;
+		atomic_vault& operator=(atomic_vault&& other) noexcept = delete;
+		~atomic_vault() = default;
+
+		[[nodiscard]] locked_t copy_locked_datum() const noexcept
+		{
+			return m_value.load(std::memory_order_acquire);
+		}
+
+		locked_t release_locked_datum() noexcept requires (std::is_default_constructible_v<locked_t>)
+		{
+			return m_value.exchange(locked_t{}, std::memory_order_acq_rel);
+		}
+
+		locked_t swap_locked_datum(locked_t&& swap_me) noexcept
+		{
+			return m_value.exchange(swap_me, std::memory_order_acq_rel);
+		}
+
+		void assign_locked_datum(const locked_t& new_datum) noexcept
+		{
+			m_value.store(new_datum, std::memory_order_release);
+		}
+
+		// Applies fn to a copy of the current value and installs the result with a CAS, retrying
+		// on interference; fn may therefore run more than once and should only compute.  Returns
+		// the value installed.
+		template<std::invocable<locked_t&> TFunction>
+		locked_t modify(TFunction fn)
+		{
+			locked_t expected = m_value.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				locked_t desired = expected;
+				std::invoke(fn, desired);
+				if (m_value.compare_exchange_weak(expected, desired, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					return desired;
+				}
+			}
+		}
+
+		// Blocks until pred(value) holds and returns that value.  Writers must call notify_one or
+		// notify_all after changing the value, as with synchro_vault.
+		template<std::predicate<const locked_t&> TPredicate>
+		locked_t wait(TPredicate pred) const
+		{
+			locked_t current = m_value.load(std::memory_order_acquire);
+			while (!std::invoke(pred, std::as_const(current)))
+			{
+				m_value.wait(current, std::memory_order_acquire);
+				current = m_value.load(std::memory_order_acquire);
+			}
+			return current;
+		}
+
+		void notify_one() noexcept { m_value.notify_one(); }
+		void notify_all() noexcept { m_value.notify_all(); }
+
+	private:
+		std::atomic<locked_t> m_value;
+	};
+
+	template<typename TLocked, concepts::mutex TMutex = std::mutex>
+	struct vault_for
+	{
+		using type = synchro_vault<TLocked, TMutex>;
+	};
+
+	template<lock_free_payload TLocked, concepts::mutex TMutex>
+	struct vault_for<TLocked, TMutex>
+	{
+		using type = atomic_vault<TLocked>;
+	};
+
+	// atomic_vault when TLocked qualifies as a lock_free_payload, otherwise synchro_vault.
+	template<typename TLocked, concepts::mutex TMutex = std::mutex>
+	using vault_for_t = typename vault_for<TLocked, TMutex>::type;
+}
+#endif
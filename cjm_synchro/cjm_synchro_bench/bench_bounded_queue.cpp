@@ -0,0 +1,133 @@
+#include "bench_harness.hpp"
+#include "cjm_synchro.hpp"
+#include "cjm_synchro_bounded_queue.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cjm::synchro::bench
+{
+	namespace
+	{
+		constexpr std::size_t queue_capacity = 256;
+		constexpr std::size_t batch_size = 32;
+		constexpr std::size_t producer_count = 2;
+		constexpr std::size_t consumer_count = 2;
+
+		// Runs producers and consumers to completion moving n elements in total; the items are
+		// split evenly, any remainder going to the first producer / consumer.
+		template<typename TProduce, typename TConsume>
+		void run_pipeline(std::size_t n, TProduce produce, TConsume consume)
+		{
+			std::vector<std::thread> threads;
+			for (std::size_t p = 0; p < producer_count; ++p)
+			{
+				threads.emplace_back([=] { produce(n / producer_count + (p == 0 ? n % producer_count : 0)); });
+			}
+			for (std::size_t c = 0; c < consumer_count; ++c)
+			{
+				threads.emplace_back([=] { consume(n / consumer_count + (c == 0 ? n % consumer_count : 0)); });
+			}
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		// The hand-rolled queue this replaces: a vault around a deque, one lock round-trip and
+		// one notify_all of the vault's single condition variable per element.
+		double time_naive_vault_queue(std::size_t iterations, std::size_t repetitions)
+		{
+			synchro_vault<std::deque<std::uint64_t>> vault{};
+			return best_ns_per_op(iterations, repetitions, [&vault](std::size_t n)
+			{
+				run_pipeline(n,
+					[&vault](std::size_t count)
+					{
+						for (std::size_t i = 0; i < count; ++i)
+						{
+							auto ptr = vault.lock();
+							ptr.wait([&ptr] { return ptr->size() < queue_capacity; });
+							ptr->push_back(i);
+							ptr.notify_all();
+						}
+					},
+					[&vault](std::size_t count)
+					{
+						for (std::size_t i = 0; i < count; ++i)
+						{
+							auto ptr = vault.lock();
+							ptr.wait([&ptr] { return !ptr->empty(); });
+							do_not_optimize(ptr->front());
+							ptr->pop_front();
+							ptr.notify_all();
+						}
+					});
+			});
+		}
+
+		double time_bounded_queue(std::size_t iterations, std::size_t repetitions)
+		{
+			bounded_queue<std::uint64_t> queue{ queue_capacity };
+			return best_ns_per_op(iterations, repetitions, [&queue](std::size_t n)
+			{
+				run_pipeline(n,
+					[&queue](std::size_t count)
+					{
+						for (std::size_t i = 0; i < count; ++i)
+						{
+							queue.push(i);
+						}
+					},
+					[&queue](std::size_t count)
+					{
+						for (std::size_t i = 0; i < count; ++i)
+						{
+							do_not_optimize(queue.pop());
+						}
+					});
+			});
+		}
+
+		double time_bounded_queue_batched(std::size_t iterations, std::size_t repetitions)
+		{
+			bounded_queue<std::uint64_t> queue{ queue_capacity };
+			return best_ns_per_op(iterations, repetitions, [&queue](std::size_t n)
+			{
+				run_pipeline(n,
+					[&queue](std::size_t count)
+					{
+						std::vector<std::uint64_t> batch(batch_size);
+						for (std::size_t done = 0; done < count; )
+						{
+							const std::size_t take = std::min(batch_size, count - done);
+							queue.push_n(batch.begin(), take);
+							done += take;
+						}
+					},
+					[&queue](std::size_t count)
+					{
+						std::vector<std::uint64_t> batch(batch_size);
+						for (std::size_t done = 0; done < count; )
+						{
+							done += queue.pop_n(batch.begin(), std::min(batch_size, count - done));
+							do_not_optimize(batch.front());
+						}
+					});
+			});
+		}
+	}
+
+	void run_bounded_queue_bench(std::size_t iterations, std::size_t repetitions)
+	{
+		std::cout << "bounded MPMC queue (" << producer_count << " producers, " << consumer_count
+			<< " consumers, capacity " << queue_capacity << ", ns per element)\n";
+		report("synchro_vault<deque> per element", time_naive_vault_queue(iterations, repetitions));
+		report("bounded_queue push/pop", time_bounded_queue(iterations, repetitions));
+		report("bounded_queue push_n/pop_n (32)", time_bounded_queue_batched(iterations, repetitions));
+	}
+}
@@ -0,0 +1,169 @@
+#ifndef CJM_SYNCHRO_BENCH_HARNESS_HPP_
+#define CJM_SYNCHRO_BENCH_HARNESS_HPP_
+#include "cjm_synchro.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace cjm::synchro::bench
+{
+	template<typename T>
+	inline void do_not_optimize(const T& value) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		const volatile auto* sink = &value;
+		(void)sink;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	// Runs body(iterations) for a number of repetitions and reports the best per-iteration time;
+	// the minimum is the least noisy estimate of the cost of an uncontended operation.
+	template<typename TBody>
+	double best_ns_per_op(std::size_t iterations, std::size_t repetitions, TBody body)
+	{
+		using clock_t = std::chrono::steady_clock;
+		double best = std::numeric_limits<double>::max();
+		body(iterations / 10 + 1);
+		for (std::size_t rep = 0; rep < repetitions; ++rep)
+		{
+			const auto start = clock_t::now();
+			body(iterations);
+			const auto elapsed = std::chrono::duration<double, std::nano>(clock_t::now() - start).count();
+			best = std::min(best, elapsed / static_cast<double>(iterations));
+		}
+		return best;
+	}
+
+	// Uncontended lock, ++value, unlock on a fresh synchro_vault<TCounter>, for counter types that
+	// differ only in their vault_traits.
+	template<typename TCounter>
+	double time_vault(std::size_t iterations, std::size_t repetitions)
+	{
+		synchro_vault<TCounter> vault{};
+		return best_ns_per_op(iterations, repetitions, [&vault](std::size_t n)
+		{
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				auto ptr = vault.lock();
+				++ptr->value;
+				do_not_optimize(ptr->value);
+			}
+		});
+	}
+
+	// Log-linear histogram of nanosecond latencies in the style of HdrHistogram: each power of two
+	// is split into 128 linear sub-buckets, so any recorded value is reported to within 1% and
+	// the whole 64-bit range fits in a fixed array.  Per-thread instances are merged afterwards.
+	class latency_histogram
+	{
+	public:
+		static constexpr unsigned sub_bucket_bits = 7;
+		static constexpr std::uint64_t sub_bucket_count = std::uint64_t{ 1 } << sub_bucket_bits;
+		static constexpr std::size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+		void record(std::int64_t ns) noexcept
+		{
+			const std::uint64_t value = ns < 0 ? 0 : static_cast<std::uint64_t>(ns);
+			++m_counts[index_of(value)];
+			++m_total;
+			m_max = std::max(m_max, value);
+		}
+
+		void merge(const latency_histogram& other) noexcept
+		{
+			for (std::size_t i = 0; i < bucket_count; ++i)
+			{
+				m_counts[i] += other.m_counts[i];
+			}
+			m_total += other.m_total;
+			m_max = std::max(m_max, other.m_max);
+		}
+
+		[[nodiscard]] std::uint64_t total() const noexcept { return m_total; }
+		[[nodiscard]] std::uint64_t max() const noexcept { return m_max; }
+
+		// Highest value equivalent to the bucket holding the q-th quantile, clamped to the
+		// largest value actually recorded.
+		[[nodiscard]] std::uint64_t percentile(double q) const noexcept
+		{
+			if (m_total == 0)
+			{
+				return 0;
+			}
+			const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(q * static_cast<double>(m_total) + 0.5));
+			std::uint64_t seen = 0;
+			for (std::size_t i = 0; i < bucket_count; ++i)
+			{
+				seen += m_counts[i];
+				if (seen >= rank)
+				{
+					return std::min(highest_equivalent(i), m_max);
+				}
+			}
+			return m_max;
+		}
+
+	private:
+		static constexpr std::size_t index_of(std::uint64_t value) noexcept
+		{
+			if (value < sub_bucket_count)
+			{
+				return static_cast<std::size_t>(value);
+			}
+			const unsigned shift = static_cast<unsigned>(std::bit_width(value)) - 1 - sub_bucket_bits;
+			return static_cast<std::size_t>((shift + 1) * sub_bucket_count + ((value >> shift) - sub_bucket_count));
+		}
+
+		static constexpr std::uint64_t highest_equivalent(std::size_t index) noexcept
+		{
+			if (index < sub_bucket_count)
+			{
+				return index;
+			}
+			const std::uint64_t shift = index / sub_bucket_count - 1;
+			const std::uint64_t sub = index % sub_bucket_count + sub_bucket_count;
+			return ((sub + 1) << shift) - 1;
+		}
+
+		std::array<std::uint64_t, bucket_count> m_counts{};
+		std::uint64_t m_total{ 0 };
+		std::uint64_t m_max{ 0 };
+	};
+
+	// Column value for a mutex level in the CSV that --suite and --load print.
+	constexpr std::string_view level_name(concepts::mutex_level level) noexcept
+	{
+		switch (level)
+		{
+		case concepts::mutex_level::std_mutex: return "std_mutex";
+		case concepts::mutex_level::basic: return "basic";
+		case concepts::mutex_level::shared: return "shared";
+		case concepts::mutex_level::upgrade: return "upgrade";
+		case concepts::mutex_level::seqlock: return "seqlock";
+		}
+		return "unknown";
+	}
+
+	inline void report(std::string_view name, double ns_per_op, std::size_t size_bytes = 0)
+	{
+		std::cout << "  " << std::left << std::setw(44) << name << std::right << std::setw(10)
+			<< std::fixed << std::setprecision(2) << ns_per_op << " ns/op";
+		if (size_bytes != 0)
+		{
+			std::cout << std::setw(8) << size_bytes << " bytes";
+		}
+		std::cout << '\n';
+	}
+}
+#endif
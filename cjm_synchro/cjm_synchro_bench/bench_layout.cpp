@@ -0,0 +1,119 @@
+#include "bench_harness.hpp"
+#include "cjm_synchro.hpp"
+#include "cjm_synchro_adaptive_mutex.hpp"
+#include "cjm_synchro_vault_array.hpp"
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cjm::synchro::bench
+{
+	struct packed_record { std::uint64_t fields[4]{}; };
+	struct isolated_record { std::uint64_t fields[4]{}; };
+	struct colocated_record { std::uint64_t fields[4]{}; };
+}
+
+template<>
+struct cjm::synchro::vault_traits<cjm::synchro::bench::isolated_record, cjm::synchro::adaptive_mutex, cjm::synchro::concepts::mutex_level::basic>
+{
+	static constexpr layout_policy layout = layout_policy::isolated_mutex;
+};
+
+template<>
+struct cjm::synchro::vault_traits<cjm::synchro::bench::colocated_record, cjm::synchro::adaptive_mutex, cjm::synchro::concepts::mutex_level::basic>
+{
+	static constexpr layout_policy layout = layout_policy::colocated;
+	// A four-byte condition, so the record starts on the mutex's line.
+	static constexpr wait_policy wait = wait_policy::futex;
+};
+
+namespace cjm::synchro::bench
+{
+	namespace
+	{
+		constexpr std::size_t layout_thread_count = 4;
+
+		// Splits n operations evenly over the threads (remainder to the first) and runs them together.
+		template<typename TWork>
+		void run_threads(std::size_t n, TWork work)
+		{
+			std::vector<std::thread> threads;
+			for (std::size_t t = 0; t < layout_thread_count; ++t)
+			{
+				threads.emplace_back([=] { work(t, n / layout_thread_count + (t == 0 ? n % layout_thread_count : 0)); });
+			}
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		// Every thread locks and mutates only its own vault; any slowdown with more threads is
+		// the neighbouring vaults' lines bouncing between cores.
+		template<typename TVaults>
+		double time_private_vaults(std::size_t iterations, std::size_t repetitions)
+		{
+			TVaults vaults{};
+			return best_ns_per_op(iterations, repetitions, [&vaults](std::size_t n)
+			{
+				run_threads(n, [&vaults](std::size_t index, std::size_t count)
+				{
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						auto ptr = vaults[index].lock();
+						++*ptr;
+						do_not_optimize(*ptr);
+					}
+				});
+			});
+		}
+
+		// All threads take turns on one vault whose spinning mutex sits next to (or away from) the
+		// record the holder writes.
+		template<typename TRecord>
+		double time_shared_vault(std::size_t iterations, std::size_t repetitions)
+		{
+			synchro_vault<TRecord, adaptive_mutex> vault{};
+			return best_ns_per_op(iterations, repetitions, [&vault](std::size_t n)
+			{
+				run_threads(n, [&vault](std::size_t, std::size_t count)
+				{
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						auto ptr = vault.lock();
+						for (auto& field : ptr->fields)
+						{
+							++field;
+						}
+						do_not_optimize(ptr->fields[0]);
+					}
+				});
+			});
+		}
+	}
+
+	// Only meaningful with at least layout_thread_count cores: on fewer, the threads take turns
+	// instead of running at once, no line ever bounces, and the rows differ only by the padding's
+	// footprint.  No multi-core results have been recorded for this bench yet; layout_policy
+	// stays packed by default until they are.
+	void run_layout_bench(std::size_t iterations, std::size_t repetitions)
+	{
+		using packed_vaults_t = std::array<synchro_vault<std::uint64_t>, layout_thread_count>;
+		using padded_vaults_t = vault_array<std::uint64_t, layout_thread_count>;
+
+		std::cout << "cache-line layout (" << layout_thread_count << " threads, line "
+			<< detail::cache_line_size << " bytes, " << std::thread::hardware_concurrency() << " hardware threads)\n";
+		report("private vaults, std::array (adjacent)", time_private_vaults<packed_vaults_t>(iterations, repetitions),
+			sizeof(packed_vaults_t) / layout_thread_count);
+		report("private vaults, vault_array (padded)", time_private_vaults<padded_vaults_t>(iterations, repetitions),
+			sizeof(padded_vaults_t) / layout_thread_count);
+		report("shared vault, layout_policy::packed", time_shared_vault<packed_record>(iterations, repetitions),
+			sizeof(synchro_vault<packed_record, adaptive_mutex>));
+		report("shared vault, layout_policy::isolated_mutex", time_shared_vault<isolated_record>(iterations, repetitions),
+			sizeof(synchro_vault<isolated_record, adaptive_mutex>));
+		report("shared vault, layout_policy::colocated", time_shared_vault<colocated_record>(iterations, repetitions),
+			sizeof(synchro_vault<colocated_record, adaptive_mutex>));
+	}
+}
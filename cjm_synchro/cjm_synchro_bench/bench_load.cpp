@@ -0,0 +1,210 @@
+#include "bench_harness.hpp"
+#include "cjm_synchro.hpp"
+#include "cjm_synchro_adaptive_mutex.hpp"
+#include <chrono>
+#include <cstdint>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+#include <boost/thread/shared_mutex.hpp>
+#endif
+
+namespace cjm::synchro::bench
+{
+	namespace
+	{
+		using load_clock_t = std::chrono::steady_clock;
+
+		// One cache line, trivially copyable so the seqlock level can hold it too.
+		struct load_record
+		{
+			std::uint64_t fields[8]{};
+		};
+
+		struct load_config
+		{
+			double rate_per_sec;
+			double seconds;
+			std::size_t threads;
+			unsigned read_percent;
+			std::chrono::nanoseconds hold;
+		};
+
+		struct load_histograms
+		{
+			latency_histogram reads;
+			latency_histogram writes;
+		};
+
+		// xorshift64*: the same seed gives every vault the same sequence of reads and writes.
+		class load_rng
+		{
+		public:
+			explicit load_rng(std::uint64_t seed) noexcept : m_state{ seed * 0x9E3779B97F4A7C15ull | 1 } {}
+
+			std::uint64_t next() noexcept
+			{
+				m_state ^= m_state >> 12;
+				m_state ^= m_state << 25;
+				m_state ^= m_state >> 27;
+				return m_state * 0x2545F4914F6CDD1Dull;
+			}
+
+		private:
+			std::uint64_t m_state;
+		};
+
+		void wait_until(load_clock_t::time_point intended)
+		{
+			constexpr auto sleep_slack = std::chrono::microseconds{ 100 };
+			if (intended - load_clock_t::now() > sleep_slack)
+			{
+				std::this_thread::sleep_until(intended - sleep_slack);
+			}
+			while (load_clock_t::now() < intended)
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		void spin_for(std::chrono::nanoseconds hold)
+		{
+			const auto until = load_clock_t::now() + hold;
+			while (load_clock_t::now() < until)
+			{
+			}
+		}
+
+		// Open loop: every thread owns an equal share of the arrival rate and a fixed schedule of
+		// intended start times, interleaved with the other threads'.  A request that cannot start
+		// on time (because the previous one on that thread is still blocked) starts late, and
+		// its latency is still measured from the intended start, so queueing behind a stalled
+		// lock holder shows up in the tail instead of silently lowering the offered load.
+		template<typename TVault>
+		void drive(TVault& vault, const load_config& config, std::size_t index, load_clock_t::time_point origin,
+			load_histograms& histograms)
+		{
+			const double interval_ns = 1e9 * static_cast<double>(config.threads) / config.rate_per_sec;
+			const double offset_ns = interval_ns * static_cast<double>(index) / static_cast<double>(config.threads);
+			const auto end = origin + std::chrono::duration_cast<load_clock_t::duration>(std::chrono::duration<double>{ config.seconds });
+			load_rng rng{ index + 1 };
+			load_record write_value{};
+			write_value.fields[1] = index;
+
+			for (std::uint64_t k = 0; ; ++k)
+			{
+				const auto intended = origin + std::chrono::duration_cast<load_clock_t::duration>(
+					std::chrono::duration<double, std::nano>{ offset_ns + interval_ns * static_cast<double>(k) });
+				if (intended >= end)
+				{
+					break;
+				}
+				wait_until(intended);
+
+				const bool is_read = rng.next() % 100 < config.read_percent;
+				if (is_read)
+				{
+					auto copy = vault.copy_locked_datum();
+					do_not_optimize(copy);
+				}
+				else if (config.hold.count() == 0)
+				{
+					write_value.fields[0] = k;
+					vault.assign_locked_datum(write_value);
+				}
+				else
+				{
+					auto ptr = vault.lock();
+					++ptr->fields[0];
+					spin_for(config.hold);
+				}
+
+				const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(load_clock_t::now() - intended).count();
+				(is_read ? histograms.reads : histograms.writes).record(latency);
+			}
+		}
+
+		void emit_header()
+		{
+			std::cout << "mutex,level,op,threads,read_percent,hold_ns,target_rate,achieved_rate,requests,"
+				"p50_ns,p90_ns,p99_ns,p999_ns,p9999_ns,max_ns\n";
+		}
+
+		void emit(std::string_view mutex, std::string_view level, std::string_view op, const load_config& config,
+			double seconds, const latency_histogram& histogram)
+		{
+			std::cout << mutex << ',' << level << ',' << op << ',' << config.threads << ',' << config.read_percent << ','
+				<< config.hold.count() << ',' << std::fixed << std::setprecision(0) << config.rate_per_sec << ','
+				<< static_cast<double>(histogram.total()) / seconds << ',' << histogram.total() << ','
+				<< histogram.percentile(0.50) << ',' << histogram.percentile(0.90) << ','
+				<< histogram.percentile(0.99) << ',' << histogram.percentile(0.999) << ','
+				<< histogram.percentile(0.9999) << ',' << histogram.max() << '\n';
+		}
+
+		template<concepts::mutex TMutex, concepts::mutex_level Level = concepts::level_v<TMutex>>
+		void run_load_on(std::string_view mutex, const load_config& config)
+		{
+			synchro_vault<load_record, TMutex, Level> vault{};
+			std::vector<std::unique_ptr<load_histograms>> histograms;
+			for (std::size_t index = 0; index < config.threads; ++index)
+			{
+				histograms.push_back(std::make_unique<load_histograms>());
+			}
+
+			// Intended start times are relative to an origin a little in the future, so that
+			// thread start-up is not charged to the first requests.
+			const auto origin = load_clock_t::now() + std::chrono::milliseconds{ 10 };
+			std::latch started{ static_cast<std::ptrdiff_t>(config.threads) };
+			std::vector<std::thread> pool;
+			for (std::size_t index = 0; index < config.threads; ++index)
+			{
+				pool.emplace_back([&, index]
+				{
+					started.arrive_and_wait();
+					drive(vault, config, index, origin, *histograms[index]);
+				});
+			}
+			for (auto& thread : pool)
+			{
+				thread.join();
+			}
+			const double seconds = std::chrono::duration<double>(load_clock_t::now() - origin).count();
+
+			latency_histogram reads, writes, all;
+			for (const auto& mine : histograms)
+			{
+				reads.merge(mine->reads);
+				writes.merge(mine->writes);
+			}
+			all.merge(reads);
+			all.merge(writes);
+			constexpr std::string_view level = level_name(Level);
+			emit(mutex, level, "all", config, seconds, all);
+			emit(mutex, level, "read", config, seconds, reads);
+			emit(mutex, level, "write", config, seconds, writes);
+		}
+	}
+
+	// Offers the same open-loop load to one vault of each mode in turn and prints a CSV row of
+	// latency percentiles (from intended start time) for all requests, reads and writes.  Reads
+	// are copy_locked_datum; writes are assign_locked_datum, or, when hold_ns is non-zero, an
+	// exclusive locked_ptr that mutates the record and keeps the lock for hold_ns.
+	void run_load(double rate_per_sec, double seconds, std::size_t threads, unsigned read_percent, std::uint64_t hold_ns)
+	{
+		const load_config config{ rate_per_sec > 0.0 ? rate_per_sec : 1.0, seconds, std::max<std::size_t>(threads, 1),
+			std::min(read_percent, 100u), std::chrono::nanoseconds{ static_cast<std::int64_t>(hold_ns) } };
+		emit_header();
+		run_load_on<std::mutex>("std::mutex", config);
+		run_load_on<std::mutex, concepts::mutex_level::seqlock>("std::mutex", config);
+		run_load_on<adaptive_mutex>("cjm::synchro::adaptive_mutex", config);
+		run_load_on<std::shared_mutex>("std::shared_mutex", config);
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+		run_load_on<boost::shared_mutex>("boost::shared_mutex", config);
+#endif
+	}
+}
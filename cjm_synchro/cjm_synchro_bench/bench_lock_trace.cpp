@@ -0,0 +1,49 @@
+#include "bench_harness.hpp"
+#include "cjm_synchro.hpp"
+#include <cstdint>
+#include <mutex>
+
+namespace cjm::synchro::bench
+{
+	struct untraced_counter { std::uint64_t value{ 0 }; };
+	struct counted_counter { std::uint64_t value{ 0 }; };
+	struct traced_counter { std::uint64_t value{ 0 }; };
+}
+
+template<>
+struct cjm::synchro::vault_traits<cjm::synchro::bench::counted_counter, std::mutex, cjm::synchro::concepts::mutex_level::std_mutex>
+{
+	static constexpr stats_policy stats = stats_policy::enabled;
+};
+
+template<>
+struct cjm::synchro::vault_traits<cjm::synchro::bench::traced_counter, std::mutex, cjm::synchro::concepts::mutex_level::std_mutex>
+{
+	static constexpr stats_policy stats = stats_policy::traced;
+};
+
+namespace cjm::synchro::bench
+{
+	namespace
+	{
+		template<typename TCounter>
+		double time_and_clear(std::size_t iterations, std::size_t repetitions)
+		{
+			const double ns = time_vault<TCounter>(iterations, repetitions);
+			// the ring has long since wrapped; discard what is left so later runs start empty.
+			lock_trace::instance().clear();
+			return ns;
+		}
+	}
+
+	void run_lock_trace_bench(std::size_t iterations, std::size_t repetitions)
+	{
+		std::cout << "lock tracing (uncontended lock, mutate, unlock)\n";
+		report("stats_policy::none", time_and_clear<untraced_counter>(iterations, repetitions),
+			sizeof(locked_ptr<untraced_counter>));
+		report("stats_policy::enabled", time_and_clear<counted_counter>(iterations, repetitions),
+			sizeof(locked_ptr<counted_counter>));
+		report("stats_policy::traced", time_and_clear<traced_counter>(iterations, repetitions),
+			sizeof(locked_ptr<traced_counter>));
+	}
+}
@@ -0,0 +1,94 @@
+#include "bench_harness.hpp"
+#include "cjm_synchro.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace cjm::synchro::bench
+{
+	struct runtime_counter { std::uint64_t value{ 0 }; };
+	struct silent_counter { std::uint64_t value{ 0 }; };
+	struct notify_all_counter { std::uint64_t value{ 0 }; };
+}
+
+template<>
+struct cjm::synchro::vault_traits<cjm::synchro::bench::silent_counter, std::mutex, cjm::synchro::concepts::mutex_level::std_mutex>
+{
+	static constexpr release_notify_policy release_notify = release_notify_policy::none;
+};
+
+template<>
+struct cjm::synchro::vault_traits<cjm::synchro::bench::notify_all_counter, std::mutex, cjm::synchro::concepts::mutex_level::std_mutex>
+{
+	static constexpr release_notify_policy release_notify = release_notify_policy::all;
+};
+
+namespace cjm::synchro::bench
+{
+	namespace
+	{
+		// Reproduces the release path locked_ptr had before the policy existed: an atomic
+		// exchange of the notification setting on every release.
+		class legacy_locked_ptr
+		{
+		public:
+			legacy_locked_ptr(std::mutex& mutex, std::uint64_t& value) : m_lock{ mutex }, m_value{ &value } {}
+			legacy_locked_ptr(const legacy_locked_ptr& other) = delete;
+			legacy_locked_ptr& operator=(const legacy_locked_ptr& other) = delete;
+			~legacy_locked_ptr()
+			{
+				const lock_release_notify notify = m_notify.exchange(lock_release_notify::none);
+				m_lock.unlock();
+				if (notify == lock_release_notify::one)
+				{
+					m_cv->notify_one();
+				}
+				else if (notify == lock_release_notify::all)
+				{
+					m_cv->notify_all();
+				}
+			}
+			std::uint64_t& operator*() const noexcept { return *m_value; }
+		private:
+			std::atomic<lock_release_notify> m_notify{ lock_release_notify::none };
+			std::unique_lock<std::mutex> m_lock;
+			std::condition_variable* m_cv{ nullptr };
+			std::uint64_t* m_value;
+		};
+	}
+
+	void run_release_notify_bench(std::size_t iterations, std::size_t repetitions)
+	{
+		std::cout << "release notification (uncontended lock, mutate, unlock)\n";
+
+		std::mutex mutex;
+		std::uint64_t raw_value = 0;
+		report("std::mutex lock/unlock", best_ns_per_op(iterations, repetitions, [&](std::size_t n)
+		{
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				auto lck = std::unique_lock<std::mutex>{ mutex };
+				++raw_value;
+				do_not_optimize(raw_value);
+			}
+		}));
+
+		report("legacy atomic notification", best_ns_per_op(iterations, repetitions, [&](std::size_t n)
+		{
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				auto ptr = legacy_locked_ptr{ mutex, raw_value };
+				++*ptr;
+				do_not_optimize(*ptr);
+			}
+		}), sizeof(legacy_locked_ptr));
+
+		report("release_notify_policy::runtime", time_vault<runtime_counter>(iterations, repetitions),
+			sizeof(locked_ptr<runtime_counter>));
+		report("release_notify_policy::none", time_vault<silent_counter>(iterations, repetitions),
+			sizeof(locked_ptr<silent_counter>));
+		report("release_notify_policy::all (no waiters)", time_vault<notify_all_counter>(iterations, repetitions),
+			sizeof(locked_ptr<notify_all_counter>));
+	}
+}
@@ -0,0 +1,307 @@
+#include "bench_harness.hpp"
+#include "cjm_synchro.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <latch>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#endif
+
+namespace cjm::synchro::bench
+{
+	namespace
+	{
+		using suite_clock_t = std::chrono::steady_clock;
+
+		// Trivially copyable so the same datum also works at the seqlock level.
+		struct suite_datum
+		{
+			std::uint64_t value{ 0 };
+			std::int64_t stamp_ns{ 0 };
+			std::uint64_t token{ 0 };
+			std::uint64_t payload{ 0 };
+		};
+
+		struct suite_config
+		{
+			std::size_t max_threads;
+			std::size_t ops_per_thread;
+		};
+
+		struct suite_result
+		{
+			std::size_t ops{ 0 };
+			double ops_per_sec{ 0.0 };
+			std::int64_t p50_ns{ 0 };
+			std::int64_t p99_ns{ 0 };
+			std::int64_t p999_ns{ 0 };
+		};
+
+		std::int64_t now_ns() noexcept
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(suite_clock_t::now().time_since_epoch()).count();
+		}
+
+		// 1, 2, 4, ... up to and always including max_threads.
+		std::vector<std::size_t> thread_counts(std::size_t max_threads)
+		{
+			std::vector<std::size_t> counts;
+			for (std::size_t n = 1; n < max_threads; n *= 2)
+			{
+				counts.push_back(n);
+			}
+			counts.push_back(max_threads);
+			return counts;
+		}
+
+		// Starts body(index) on the given number of threads, releases them together and returns
+		// the wall time in seconds until the last one finishes.
+		template<typename TBody>
+		double run_together(std::size_t threads, TBody body)
+		{
+			std::latch start{ static_cast<std::ptrdiff_t>(threads + 1) };
+			std::vector<std::thread> pool;
+			pool.reserve(threads);
+			for (std::size_t index = 0; index < threads; ++index)
+			{
+				pool.emplace_back([&start, &body, index]
+				{
+					start.arrive_and_wait();
+					body(index);
+				});
+			}
+			const auto begin = suite_clock_t::now();
+			start.count_down();
+			for (auto& thread : pool)
+			{
+				thread.join();
+			}
+			return std::chrono::duration<double>(suite_clock_t::now() - begin).count();
+		}
+
+		// Latencies are sorted in place.
+		suite_result summarize(std::vector<std::int64_t>& latencies, std::size_t ops, double seconds)
+		{
+			suite_result result;
+			result.ops = ops;
+			result.ops_per_sec = seconds > 0.0 ? static_cast<double>(ops) / seconds : 0.0;
+			if (!latencies.empty())
+			{
+				std::sort(latencies.begin(), latencies.end());
+				const auto at = [&latencies](double q)
+				{
+					const auto index = static_cast<std::size_t>(q * static_cast<double>(latencies.size()));
+					return latencies[std::min(index, latencies.size() - 1)];
+				};
+				result.p50_ns = at(0.50);
+				result.p99_ns = at(0.99);
+				result.p999_ns = at(0.999);
+			}
+			return result;
+		}
+
+		// make_worker(thread index) returns the operation to repeat.  A first pass measures
+		// throughput with no timing in the loop; a second pass timestamps every operation once
+		// and takes the gap between consecutive timestamps as its latency, so each sample
+		// carries one clock read (see the clock_overhead row) rather than two.
+		template<typename TMakeWorker>
+		suite_result measure(std::size_t threads, std::size_t ops_per_thread, TMakeWorker make_worker)
+		{
+			const double seconds = run_together(threads, [&](std::size_t index)
+			{
+				auto worker = make_worker(index);
+				for (std::size_t i = 0; i < ops_per_thread; ++i)
+				{
+					worker();
+				}
+			});
+
+			std::vector<std::vector<std::int64_t>> samples(threads, std::vector<std::int64_t>(ops_per_thread));
+			run_together(threads, [&](std::size_t index)
+			{
+				auto worker = make_worker(index);
+				auto& mine = samples[index];
+				std::int64_t previous = now_ns();
+				for (std::size_t i = 0; i < ops_per_thread; ++i)
+				{
+					worker();
+					const std::int64_t current = now_ns();
+					mine[i] = current - previous;
+					previous = current;
+				}
+			});
+
+			std::vector<std::int64_t> latencies;
+			latencies.reserve(threads * ops_per_thread);
+			for (const auto& mine : samples)
+			{
+				latencies.insert(latencies.end(), mine.begin(), mine.end());
+			}
+			return summarize(latencies, threads * ops_per_thread, seconds);
+		}
+
+		// Passes a token around a ring of threads through the vault's condition variable.  Each
+		// sample is the time from the notify_all that handed a thread the token to that thread
+		// observing it with the lock held.
+		template<typename TVault>
+		suite_result measure_condition(TVault& vault, std::size_t threads, std::size_t rounds)
+		{
+			std::vector<std::vector<std::int64_t>> samples(threads);
+			const double seconds = run_together(threads, [&](std::size_t index)
+			{
+				auto& mine = samples[index];
+				mine.reserve(rounds);
+				for (std::size_t round = 0; round < rounds; ++round)
+				{
+					auto ptr = vault.lock();
+					ptr.wait([&ptr, threads, index] { return ptr->token % threads == index; });
+					const std::int64_t woke = now_ns();
+					if (ptr->stamp_ns != 0)
+					{
+						mine.push_back(woke - ptr->stamp_ns);
+					}
+					++ptr->token;
+					ptr->stamp_ns = now_ns();
+					ptr.notify_all();
+				}
+			});
+
+			std::vector<std::int64_t> latencies;
+			for (const auto& mine : samples)
+			{
+				latencies.insert(latencies.end(), mine.begin(), mine.end());
+			}
+			return summarize(latencies, threads * rounds, seconds);
+		}
+
+		void emit_header()
+		{
+			std::cout << "benchmark,mutex,level,threads,ops,ops_per_sec,p50_ns,p99_ns,p999_ns\n";
+		}
+
+		void emit(std::string_view benchmark, std::string_view mutex, std::string_view level, std::size_t threads,
+			const suite_result& result)
+		{
+			std::cout << benchmark << ',' << mutex << ',' << level << ',' << threads << ',' << result.ops << ','
+				<< std::fixed << std::setprecision(0) << result.ops_per_sec << ','
+				<< result.p50_ns << ',' << result.p99_ns << ',' << result.p999_ns << '\n';
+		}
+
+		template<concepts::mutex TMutex, concepts::mutex_level Level = concepts::level_v<TMutex>>
+		void run_mutex_suite(std::string_view mutex, const suite_config& config)
+		{
+			using vault_t = synchro_vault<suite_datum, TMutex, Level>;
+			constexpr std::string_view level = level_name(Level);
+			constexpr bool has_shared = Level == concepts::mutex_level::shared || Level == concepts::mutex_level::upgrade;
+			const std::size_t ops = config.ops_per_thread;
+
+			for (const std::size_t threads : thread_counts(config.max_threads))
+			{
+				vault_t vault{};
+				emit("lock_unlock", mutex, level, threads, measure(threads, ops, [&vault](std::size_t)
+				{
+					return [&vault]
+					{
+						auto ptr = vault.lock();
+						++ptr->value;
+						do_not_optimize(ptr->value);
+					};
+				}));
+
+				if constexpr (has_shared)
+				{
+					emit("lock_shared_unlock", mutex, level, threads, measure(threads, ops, [&vault](std::size_t)
+					{
+						return [&vault]
+						{
+							auto ptr = vault.lock_shared();
+							do_not_optimize(ptr->value);
+						};
+					}));
+				}
+
+				if constexpr (Level == concepts::mutex_level::upgrade)
+				{
+					emit("lock_upgrade_unlock", mutex, level, threads, measure(threads, ops, [&vault](std::size_t)
+					{
+						return [&vault]
+						{
+							auto ptr = vault.lock_upgrade();
+							do_not_optimize(ptr->value);
+						};
+					}));
+				}
+
+				emit("copy_locked_datum", mutex, level, threads, measure(threads, ops, [&vault](std::size_t)
+				{
+					return [&vault]
+					{
+						auto copy = vault.copy_locked_datum();
+						do_not_optimize(copy);
+					};
+				}));
+
+				emit("assign_locked_datum", mutex, level, threads, measure(threads, ops, [&vault](std::size_t index)
+				{
+					return [&vault, datum = suite_datum{ index, 0, 0, index }]() mutable
+					{
+						++datum.value;
+						vault.assign_locked_datum(datum);
+					};
+				}));
+
+				// Lock, release and reacquire through scoped_unlock, then release: two acquisitions.
+				emit("scoped_unlock_round_trip", mutex, level, threads, measure(threads, ops, [&vault](std::size_t)
+				{
+					return [&vault]
+					{
+						auto ptr = vault.lock();
+						++ptr->value;
+						{
+							auto unlocked = ptr.scoped_unlock();
+						}
+						do_not_optimize(ptr->value);
+					};
+				}));
+
+				if (threads > 1)
+				{
+					emit("condition_notify", mutex, level, threads, measure_condition(vault, threads, std::max<std::size_t>(ops / 100, 1)));
+				}
+			}
+		}
+	}
+
+	// Machine-readable companion to the per-feature benches: one CSV row per (benchmark, mutex,
+	// level, thread count) with throughput and p50/p99/p99.9 latency in nanoseconds.
+	void run_suite(std::size_t max_threads, std::size_t ops_per_thread)
+	{
+		const suite_config config{ std::max<std::size_t>(max_threads, 1), std::max<std::size_t>(ops_per_thread, 1) };
+		emit_header();
+
+		const std::size_t ops = config.ops_per_thread;
+		emit("clock_overhead", "none", "none", 1, measure(1, ops, [](std::size_t) { return [] {}; }));
+
+		run_mutex_suite<std::mutex>("std::mutex", config);
+		run_mutex_suite<std::mutex, concepts::mutex_level::seqlock>("std::mutex", config);
+		run_mutex_suite<std::recursive_mutex>("std::recursive_mutex", config);
+		run_mutex_suite<std::timed_mutex>("std::timed_mutex", config);
+		run_mutex_suite<std::recursive_timed_mutex>("std::recursive_timed_mutex", config);
+		run_mutex_suite<std::shared_mutex>("std::shared_mutex", config);
+		run_mutex_suite<std::shared_timed_mutex>("std::shared_timed_mutex", config);
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+		run_mutex_suite<boost::mutex>("boost::mutex", config);
+		run_mutex_suite<boost::timed_mutex>("boost::timed_mutex", config);
+		// boost::shared_timed_mutex and boost::upgrade_mutex are aliases of boost::shared_mutex here.
+		run_mutex_suite<boost::shared_mutex>("boost::shared_mutex", config);
+#endif
+	}
+}
@@ -0,0 +1,56 @@
+// cjm_synchro_bench.cpp : microbenchmarks for cjm_synchro.  Build optimized, e.g.
+//   g++ -std=c++20 -O2 -DCJM_SYNCHRO_USE_BOOST_FEATURE -I.. *.cpp -lboost_thread -pthread -o cjm_synchro_bench
+// Run with no arguments for the human-readable per-feature benches, or as
+//   cjm_synchro_bench --suite [max_threads] [ops_per_thread] > results.csv
+// for the CSV suite across every mutex level and mutex type, or as
+//   cjm_synchro_bench --load [rate_per_sec] [seconds] [threads] [read_percent] [hold_ns]
+// for the open-loop tail-latency comparison of vault modes under one fixed load.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace cjm::synchro::bench
+{
+	void run_release_notify_bench(std::size_t iterations, std::size_t repetitions);
+	void run_bounded_queue_bench(std::size_t iterations, std::size_t repetitions);
+	void run_lock_trace_bench(std::size_t iterations, std::size_t repetitions);
+	void run_layout_bench(std::size_t iterations, std::size_t repetitions);
+	void run_suite(std::size_t max_threads, std::size_t ops_per_thread);
+	void run_load(double rate_per_sec, double seconds, std::size_t threads, unsigned read_percent, std::uint64_t hold_ns);
+}
+
+int main(int argc, char** argv)
+{
+	using namespace cjm::synchro::bench;
+	if (argc > 1 && std::string_view{ argv[1] } == "--suite")
+	{
+		const std::size_t max_threads = argc > 2 ? std::stoul(argv[2])
+			: std::max<std::size_t>(std::thread::hardware_concurrency(), 2);
+		const std::size_t ops_per_thread = argc > 3 ? std::stoul(argv[3]) : 100'000;
+		run_suite(max_threads, ops_per_thread);
+		return 0;
+	}
+	if (argc > 1 && std::string_view{ argv[1] } == "--load")
+	{
+		const double rate_per_sec = argc > 2 ? std::stod(argv[2]) : 100'000.0;
+		const double seconds = argc > 3 ? std::stod(argv[3]) : 2.0;
+		const std::size_t threads = argc > 4 ? std::stoul(argv[4]) : 4;
+		const unsigned read_percent = argc > 5 ? static_cast<unsigned>(std::stoul(argv[5])) : 95;
+		const std::uint64_t hold_ns = argc > 6 ? std::stoull(argv[6]) : 0;
+		run_load(rate_per_sec, seconds, threads, read_percent, hold_ns);
+		return 0;
+	}
+
+	constexpr std::size_t iterations = 2'000'000;
+	constexpr std::size_t repetitions = 7;
+
+	run_release_notify_bench(iterations, repetitions);
+	run_bounded_queue_bench(iterations / 10, repetitions);
+	run_lock_trace_bench(iterations, repetitions);
+	run_layout_bench(iterations / 10, repetitions);
+	return 0;
+}
@@ -0,0 +1,278 @@
+#ifndef CJM_SYNCHRO_BOUNDED_QUEUE_HPP_
+#define CJM_SYNCHRO_BOUNDED_QUEUE_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro_adaptive_mutex.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cjm::synchro
+{
+	// Blocking bounded multi-producer multi-consumer FIFO: a ring buffer behind one TMutex with
+	// separate not-empty / not-full conditions of the type ctrl_block would pick for TMutex.
+	// push_n / pop_n move as many elements as fit per lock acquisition and wake as many threads
+	// as the batch can serve.  Only threads actually asleep are notified: a consumer that finds
+	// the queue empty first spins on a lock-free size mirror, and while it spins it is not
+	// counted, so a producer that feeds it skips the notify entirely.  The spin budget adapts
+	// as adaptive_mutex's does, so where spinning never pays off it shrinks to almost nothing.
+	template<std::movable T, concepts::mutex TMutex = std::mutex>
+	class bounded_queue
+	{
+	public:
+		using value_t = T;
+		using mutex_t = TMutex;
+		using condition_variable_t = detail::condition_variable_for_t<TMutex, concepts::level_v<TMutex>>;
+
+		explicit bounded_queue(std::size_t capacity) : m_slots(capacity)
+		{
+			if (capacity == 0)
+			{
+				throw std::invalid_argument{ "bounded_queue capacity must be positive." };
+			}
+		}
+		bounded_queue(const bounded_queue& other) = delete;
+		bounded_queue(bounded_queue&& other) noexcept = delete;
+		bounded_queue& operator=(const bounded_queue& other) = delete;
+		bounded_queue& operator=(bounded_queue&& other) noexcept = delete;
+		~bounded_queue() = default;
+
+		[[nodiscard]] std::size_t capacity() const noexcept { return m_slots.size(); }
+
+		// Advisory outside the lock: the value may be stale by the time the caller acts on it.
+		[[nodiscard]] std::size_t size() const noexcept { return m_size.load(std::memory_order_relaxed); }
+		[[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+		void push(T value)
+		{
+			auto lck = std::unique_lock<mutex_t>{ m_mutex };
+			wait_not_full(lck);
+			emplace_back_locked(std::move(value));
+			wake_after(lck, m_sleeping_consumers, m_not_empty, 1);
+		}
+
+		[[nodiscard]] bool try_push(T&& value)
+		{
+			auto lck = std::unique_lock<mutex_t>{ m_mutex };
+			if (m_count == capacity())
+			{
+				return false;
+			}
+			emplace_back_locked(std::move(value));
+			wake_after(lck, m_sleeping_consumers, m_not_empty, 1);
+			return true;
+		}
+
+		// On failure value is left untouched and false is returned.
+		template<concepts::duration Duration>
+		[[nodiscard]] bool try_push_for(T&& value, const Duration& d)
+		{
+			const auto timeout = detail::to_mutex_duration<concepts::time_type::std>(d);
+			auto lck = std::unique_lock<mutex_t>{ m_mutex };
+			if (!wait_not_full_for(lck, timeout))
+			{
+				return false;
+			}
+			emplace_back_locked(std::move(value));
+			wake_after(lck, m_sleeping_consumers, m_not_empty, 1);
+			return true;
+		}
+
+		// Moves count elements from first, blocking while the queue is full; each time the lock
+		// is held it moves as many as there is room for.  Returns the iterator past the last one.
+		template<std::input_iterator TIterator>
+			requires (std::constructible_from<T, std::iter_rvalue_reference_t<TIterator>>)
+		TIterator push_n(TIterator first, std::size_t count)
+		{
+			while (count != 0)
+			{
+				auto lck = std::unique_lock<mutex_t>{ m_mutex };
+				wait_not_full(lck);
+				const std::size_t batch = std::min(count, capacity() - m_count);
+				for (std::size_t i = 0; i < batch; ++i, ++first)
+				{
+					emplace_back_locked(std::ranges::iter_move(first));
+				}
+				count -= batch;
+				wake_after(lck, m_sleeping_consumers, m_not_empty, batch);
+			}
+			return first;
+		}
+
+		[[nodiscard]] T pop()
+		{
+			auto lck = std::unique_lock<mutex_t>{ m_mutex };
+			wait_not_empty(lck);
+			T ret = pop_front_locked();
+			wake_after(lck, m_sleeping_producers, m_not_full, 1);
+			return ret;
+		}
+
+		[[nodiscard]] std::optional<T> try_pop()
+		{
+			auto lck = std::unique_lock<mutex_t>{ m_mutex };
+			if (m_count == 0)
+			{
+				return std::nullopt;
+			}
+			std::optional<T> ret{ pop_front_locked() };
+			wake_after(lck, m_sleeping_producers, m_not_full, 1);
+			return ret;
+		}
+
+		template<concepts::duration Duration>
+		[[nodiscard]] std::optional<T> try_pop_for(const Duration& d)
+		{
+			const auto timeout = detail::to_mutex_duration<concepts::time_type::std>(d);
+			auto lck = std::unique_lock<mutex_t>{ m_mutex };
+			if (!wait_not_empty_for(lck, timeout))
+			{
+				return std::nullopt;
+			}
+			std::optional<T> ret{ pop_front_locked() };
+			wake_after(lck, m_sleeping_producers, m_not_full, 1);
+			return ret;
+		}
+
+		// Blocks until at least one element is available, then moves up to max_count of them to
+		// out under that one acquisition.  Returns the number moved (0 only if max_count is 0).
+		template<std::weakly_incrementable TOut>
+			requires (std::indirectly_writable<TOut, T&&>)
+		std::size_t pop_n(TOut out, std::size_t max_count)
+		{
+			if (max_count == 0)
+			{
+				return 0;
+			}
+			auto lck = std::unique_lock<mutex_t>{ m_mutex };
+			wait_not_empty(lck);
+			const std::size_t batch = std::min(max_count, m_count);
+			for (std::size_t i = 0; i < batch; ++i, ++out)
+			{
+				*out = pop_front_locked();
+			}
+			wake_after(lck, m_sleeping_producers, m_not_full, batch);
+			return batch;
+		}
+
+	private:
+		void emplace_back_locked(T&& value)
+		{
+			assert(m_count < capacity());
+			m_slots[(m_head + m_count) % capacity()].emplace(std::move(value));
+			++m_count;
+			m_size.store(m_count, std::memory_order_relaxed);
+		}
+
+		T pop_front_locked()
+		{
+			assert(m_count > 0);
+			auto& slot = m_slots[m_head];
+			T ret = std::move(*slot);
+			slot.reset();
+			m_head = (m_head + 1) % capacity();
+			--m_count;
+			m_size.store(m_count, std::memory_order_relaxed);
+			return ret;
+		}
+
+		// Spins on the size mirror with the lock released before committing to sleep.  Returns
+		// with the lock held either way.
+		template<std::predicate TReady>
+		static void spin_unlocked(std::unique_lock<mutex_t>& lck, detail::adaptive_spinner& spinner, TReady ready)
+		{
+			lck.unlock();
+			(void)spinner.spin(ready);
+			lck.lock();
+		}
+
+		void wait_not_empty(std::unique_lock<mutex_t>& lck)
+		{
+			if (m_count != 0)
+			{
+				return;
+			}
+			spin_unlocked(lck, m_consumer_spinner, [this] { return m_size.load(std::memory_order_relaxed) != 0; });
+			if (m_count == 0)
+			{
+				++m_sleeping_consumers;
+				m_not_empty.wait(lck, [this] { return m_count != 0; });
+				--m_sleeping_consumers;
+			}
+		}
+
+		void wait_not_full(std::unique_lock<mutex_t>& lck)
+		{
+			if (m_count != capacity())
+			{
+				return;
+			}
+			spin_unlocked(lck, m_producer_spinner, [this] { return m_size.load(std::memory_order_relaxed) != capacity(); });
+			if (m_count == capacity())
+			{
+				++m_sleeping_producers;
+				m_not_full.wait(lck, [this] { return m_count != capacity(); });
+				--m_sleeping_producers;
+			}
+		}
+
+		template<typename TDuration>
+		bool wait_not_empty_for(std::unique_lock<mutex_t>& lck, const TDuration& timeout)
+		{
+			if (m_count != 0)
+			{
+				return true;
+			}
+			++m_sleeping_consumers;
+			const bool ready = m_not_empty.wait_for(lck, timeout, [this] { return m_count != 0; });
+			--m_sleeping_consumers;
+			return ready;
+		}
+
+		template<typename TDuration>
+		bool wait_not_full_for(std::unique_lock<mutex_t>& lck, const TDuration& timeout)
+		{
+			if (m_count != capacity())
+			{
+				return true;
+			}
+			++m_sleeping_producers;
+			const bool ready = m_not_full.wait_for(lck, timeout, [this] { return m_count != capacity(); });
+			--m_sleeping_producers;
+			return ready;
+		}
+
+		// Sleepers are counted under the lock and only leave the count after reacquiring it, so
+		// reading the count here and notifying after unlocking cannot miss one.
+		static void wake_after(std::unique_lock<mutex_t>& lck, std::size_t sleepers, condition_variable_t& condition, std::size_t made_ready)
+		{
+			lck.unlock();
+			for (std::size_t woken = std::min(sleepers, made_ready); woken != 0; --woken)
+			{
+				condition.notify_one();
+			}
+		}
+
+		mutable mutex_t m_mutex;
+		condition_variable_t m_not_empty;
+		condition_variable_t m_not_full;
+		std::vector<std::optional<T>> m_slots;
+		std::size_t m_head{ 0 };
+		std::size_t m_count{ 0 };
+		std::size_t m_sleeping_consumers{ 0 };
+		std::size_t m_sleeping_producers{ 0 };
+		detail::adaptive_spinner m_consumer_spinner;
+		detail::adaptive_spinner m_producer_spinner;
+		alignas(detail::cache_line_size) std::atomic<std::size_t> m_size{ 0 };
+	};
+}
+#endif
@@ -0,0 +1,222 @@
+#ifndef CJM_SYNCHRO_COMBINING_HPP_
+#define CJM_SYNCHRO_COMBINING_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro.hpp"
+#include <array>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace cjm::synchro
+{
+	template<typename TLocked, concepts::mutex TMutex = std::mutex, concepts::mutex_level Level = concepts::level_v<TMutex>>
+	class combining_vault;
+}
+
+namespace cjm::synchro::detail
+{
+	// An operation published by a waiting thread.  It lives on the publisher's stack; the
+	// combiner runs it, then marks it complete, after which only the publisher may touch it.
+	template<typename TLocked>
+	class combining_request
+	{
+	public:
+		combining_request() noexcept = default;
+		combining_request(const combining_request& other) = delete;
+		combining_request(combining_request&& other) noexcept = delete;
+		combining_request& operator=(const combining_request& other) = delete;
+		combining_request& operator=(combining_request&& other) noexcept = delete;
+		virtual ~combining_request() = default;
+
+		virtual void execute(TLocked& locked) noexcept = 0;
+
+		void complete() noexcept
+		{
+			m_done.store(true, std::memory_order_release);
+		}
+
+		[[nodiscard]] bool is_complete() const noexcept
+		{
+			return m_done.load(std::memory_order_acquire);
+		}
+
+	private:
+		std::atomic<bool> m_done{ false };
+	};
+
+	template<typename TLocked, typename TOperation>
+	class combining_request_impl final : public combining_request<TLocked>
+	{
+	public:
+		using result_t = std::invoke_result_t<TOperation&, TLocked&>;
+
+		explicit combining_request_impl(TOperation& operation) noexcept : m_operation{ operation } {}
+
+		void execute(TLocked& locked) noexcept override
+		{
+			try
+			{
+				if constexpr (std::is_void_v<result_t>)
+				{
+					std::invoke(m_operation, locked);
+				}
+				else
+				{
+					m_result.emplace(std::invoke(m_operation, locked));
+				}
+			}
+			catch (...)
+			{
+				m_exception = std::current_exception();
+			}
+		}
+
+		result_t get()
+		{
+			if (m_exception)
+			{
+				std::rethrow_exception(m_exception);
+			}
+			if constexpr (!std::is_void_v<result_t>)
+			{
+				return std::move(*m_result);
+			}
+		}
+
+	private:
+		TOperation& m_operation;
+		std::conditional_t<std::is_void_v<result_t>, std::nullptr_t, std::optional<result_t>> m_result{};
+		std::exception_ptr m_exception{};
+	};
+
+	// Publication array: one padded slot per reader shard.  A thread claims the slot of its
+	// shard (or one of the next few) for the duration of one combine call.
+	template<typename TLocked>
+	class combining_slots
+	{
+	public:
+		static constexpr std::size_t slot_count = sharded_read_indicator::shard_count;
+		static constexpr std::size_t probe_limit = 4;
+
+		[[nodiscard]] bool publish(combining_request<TLocked>* request) noexcept
+		{
+			const std::size_t home = sharded_read_indicator::local_shard();
+			for (std::size_t probe = 0; probe < probe_limit; ++probe)
+			{
+				auto& slot = m_slots[(home + probe) % slot_count].request;
+				combining_request<TLocked>* expected = nullptr;
+				if (slot.load(std::memory_order_relaxed) == nullptr &&
+					slot.compare_exchange_strong(expected, request, std::memory_order_release, std::memory_order_relaxed))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Caller holds the vault's mutex.  The slot is vacated before the request completes so
+		// that the publisher's next request can never be mistaken for this one.
+		std::size_t run_pending(TLocked& locked) noexcept
+		{
+			std::size_t executed = 0;
+			for (auto& slot : m_slots)
+			{
+				combining_request<TLocked>* request = slot.request.load(std::memory_order_acquire);
+				if (request != nullptr)
+				{
+					slot.request.store(nullptr, std::memory_order_relaxed);
+					request->execute(locked);
+					request->complete();
+					++executed;
+				}
+			}
+			return executed;
+		}
+
+	private:
+		struct alignas(cache_line_size) slot_t
+		{
+			std::atomic<combining_request<TLocked>*> request{ nullptr };
+		};
+		std::array<slot_t, slot_count> m_slots{};
+	};
+}
+
+namespace cjm::synchro
+{
+	// synchro_vault with flat combining.  combine(fn) publishes fn and then either waits for
+	// another thread to run it or takes the mutex itself and runs every published operation in
+	// one batch, so under contention the data stays in one cache and the mutex changes hands
+	// once per batch instead of once per operation.  lock() and the rest of the synchro_vault
+	// interface remain available and interoperate with combine.
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class combining_vault : public synchro_vault<TLocked, TMutex, Level>
+	{
+		using base_t = synchro_vault<TLocked, TMutex, Level>;
+	public:
+		using locked_t = typename base_t::locked_t;
+		static constexpr unsigned max_combining_passes = 4;
+
+		combining_vault() requires (std::is_default_constructible_v<locked_t>) : base_t{} {}
+		using base_t::base_t;
+		combining_vault(const combining_vault& other) = delete;
+		combining_vault(combining_vault&& other) noexcept = delete;
+		combining_vault& operator=(const combining_vault& other) = delete;
+		combining_vault& operator=(combining_vault&& other) noexcept = delete;
+		~combining_vault() = default;
+
+		template<std::invocable<locked_t&> TOperation>
+			requires (!std::is_reference_v<std::invoke_result_t<TOperation&, locked_t&>>)
+		decltype(auto) combine(TOperation operation)
+		{
+			auto request = detail::combining_request_impl<locked_t, TOperation>{ operation };
+			if (!m_slots.publish(&request))
+			{
+				auto ptr = this->lock();
+				return std::invoke(operation, *ptr);
+			}
+			// Waiters watch their own request, not the mutex, so they do not pull its line away
+			// from the combiner.  They try the mutex right away (someone has to combine), every
+			// lock_probe_interval spins after that in case the combiner left without seeing the
+			// request, and once the spin budget is gone they block in lock(), after which their
+			// request is either complete or still published and theirs to run.
+			for (unsigned spins = 0; !request.is_complete(); ++spins)
+			{
+				if (spins >= combine_spin_limit)
+				{
+					run_as_combiner(this->lock());
+				}
+				else if (spins % lock_probe_interval == 0)
+				{
+					auto lck = detail::vault_access::defer(static_cast<base_t&>(*this));
+					if (lck.try_lock())
+					{
+						run_as_combiner(detail::vault_access::adopt(static_cast<base_t&>(*this), std::move(lck)));
+					}
+				}
+				else
+				{
+					detail::cpu_relax();
+				}
+			}
+			return request.get();
+		}
+
+	private:
+		static constexpr unsigned lock_probe_interval = 16;
+		static constexpr unsigned combine_spin_limit = 1024;
+
+		template<typename TLockedPtr>
+		void run_as_combiner(TLockedPtr ptr) noexcept
+		{
+			for (unsigned pass = 0; pass < max_combining_passes && m_slots.run_pending(*ptr) != 0; ++pass) {}
+		}
+
+		detail::combining_slots<locked_t> m_slots;
+	};
+}
+#endif
@@ -19,6 +19,19 @@ namespace cjm::synchro::concepts
 			std::intmax_t> && std::is_nothrow_convertible_v<decltype(TRatio::den),
 				std::intmax_t>;
 
+		// std::chrono::duration and boost::chrono::duration static_assert on the other library's
+		// ratio, so check which ratio a period is before forming either duration type.
+		template<typename TRatio>
+		concept std_ratio = ratio<TRatio> && std::is_same_v<typename TRatio::type, std::ratio<TRatio::num, TRatio::den>>;
+
+		template<typename TRatio>
+		concept boost_ratio =
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+			ratio<TRatio> && std::is_same_v<typename TRatio::type, boost::ratio<TRatio::num, TRatio::den>>;
+#else
+			false;
+#endif
+
 		template <typename T>
 		concept is_bool = std::is_same_v<std::remove_cvref_t<std::remove_const_t<T>>, bool>;
 		
@@ -36,13 +49,13 @@ namespace cjm::synchro::concepts
 		};
 		
 		template<typename TDuration>
-		concept std_duration = base_duration<TDuration> &&
+		concept std_duration = base_duration<TDuration> && std_ratio<typename TDuration::period> &&
 			detail::nothrow_convertible_to<TDuration, std::chrono::duration<typename TDuration::rep, typename TDuration::period>>;
 
 		template<typename TDuration>
 		concept boost_duration =
 #ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
-			base_duration<TDuration> && detail::nothrow_convertible_to<TDuration, boost::chrono::duration<typename TDuration::rep, typename TDuration::period>>;
+			base_duration<TDuration> && boost_ratio<typename TDuration::period> && detail::nothrow_convertible_to<TDuration, boost::chrono::duration<typename TDuration::rep, typename TDuration::period>>;
 #else
 			false;
 #endif
@@ -239,7 +252,8 @@ namespace cjm::synchro::concepts
 		std_mutex = 0,
 		basic,
 		shared,
-		upgrade
+		upgrade,
+		seqlock
 	};
 
 	enum class lock_state
@@ -284,7 +298,7 @@ namespace cjm::synchro::concepts
 		static constexpr mutex_level get_mutex_level() noexcept;
 		
 		template<duration TDuration, time_point TTime>
-		static constexpr bool supports_exclusive_timed_locks_with = timed_mutex<TMutex, TDuration, TTime>;
+		static constexpr bool supports_exclusive_timed_locks_with = timed_lockable_with<TMutex, TDuration, TTime>;
 		
 		static constexpr bool is_shared = shared_mutex<TMutex>;
 		static constexpr bool is_timed = timed_mutex<TMutex>;
@@ -0,0 +1,233 @@
+#ifndef CJM_SYNCHRO_DELEGATING_HPP_
+#define CJM_SYNCHRO_DELEGATING_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace cjm::synchro
+{
+	template<typename TLocked, concepts::mutex TMutex = std::mutex, concepts::mutex_level Level = concepts::level_v<TMutex>>
+	class delegating_vault;
+}
+
+namespace cjm::synchro::detail
+{
+	template<typename TLocked>
+	class delegated_task
+	{
+	public:
+		delegated_task() noexcept = default;
+		delegated_task(const delegated_task& other) = delete;
+		delegated_task(delegated_task&& other) noexcept = delete;
+		delegated_task& operator=(const delegated_task& other) = delete;
+		delegated_task& operator=(delegated_task&& other) noexcept = delete;
+		virtual ~delegated_task() = default;
+
+		virtual void run(TLocked& locked) noexcept = 0;
+
+		delegated_task* next{ nullptr };
+	};
+
+	template<typename TLocked, typename TFunction>
+	class promised_task final : public delegated_task<TLocked>
+	{
+	public:
+		using result_t = std::invoke_result_t<TFunction&, TLocked&>;
+
+		explicit promised_task(TFunction function) : m_function{ std::move(function) } {}
+
+		[[nodiscard]] std::future<result_t> get_future() { return m_promise.get_future(); }
+
+		void run(TLocked& locked) noexcept override
+		{
+			try
+			{
+				if constexpr (std::is_void_v<result_t>)
+				{
+					std::invoke(m_function, locked);
+					m_promise.set_value();
+				}
+				else
+				{
+					m_promise.set_value(std::invoke(m_function, locked));
+				}
+			}
+			catch (...)
+			{
+				m_promise.set_exception(std::current_exception());
+			}
+		}
+
+	private:
+		TFunction m_function;
+		std::promise<result_t> m_promise;
+	};
+
+	// Fire-and-forget task: an exception escaping it terminates, as it would on any thread.
+	template<typename TLocked, typename TFunction>
+	class posted_task final : public delegated_task<TLocked>
+	{
+	public:
+		explicit posted_task(TFunction function) : m_function{ std::move(function) } {}
+
+		void run(TLocked& locked) noexcept override
+		{
+			std::invoke(m_function, locked);
+		}
+
+	private:
+		TFunction m_function;
+	};
+
+	// Multi-producer, single-consumer task queue.  Producers push onto a lock-free stack; the
+	// consumer detaches the whole stack with one exchange and reverses it, so tasks run in
+	// submission order and each batch costs the consumer a single atomic operation.
+	template<typename TLocked>
+	class delegation_queue
+	{
+	public:
+		delegation_queue() noexcept = default;
+		delegation_queue(const delegation_queue& other) = delete;
+		delegation_queue(delegation_queue&& other) noexcept = delete;
+		delegation_queue& operator=(const delegation_queue& other) = delete;
+		delegation_queue& operator=(delegation_queue&& other) noexcept = delete;
+		~delegation_queue()
+		{
+			assert(m_head.load(std::memory_order_relaxed) == nullptr);
+		}
+
+		void push(std::unique_ptr<delegated_task<TLocked>> task) noexcept
+		{
+			delegated_task<TLocked>* node = task.release();
+			delegated_task<TLocked>* head = m_head.load(std::memory_order_relaxed);
+			do
+			{
+				node->next = head;
+			} while (!m_head.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		[[nodiscard]] bool empty() const noexcept
+		{
+			return m_head.load(std::memory_order_acquire) == nullptr;
+		}
+
+		// Runs the one batch detached now; tasks pushed meanwhile wait for the next call, so a
+		// caller that holds a lock across drain holds it for a bounded amount of work.
+		std::size_t drain(TLocked& locked) noexcept
+		{
+			delegated_task<TLocked>* batch = m_head.exchange(nullptr, std::memory_order_acquire);
+			delegated_task<TLocked>* ordered = nullptr;
+			while (batch != nullptr)
+			{
+				delegated_task<TLocked>* next = batch->next;
+				batch->next = ordered;
+				ordered = batch;
+				batch = next;
+			}
+			std::size_t executed = 0;
+			while (ordered != nullptr)
+			{
+				std::unique_ptr<delegated_task<TLocked>> task{ ordered };
+				ordered = ordered->next;
+				task->run(locked);
+				++executed;
+			}
+			return executed;
+		}
+
+	private:
+		std::atomic<delegated_task<TLocked>*> m_head{ nullptr };
+	};
+}
+
+namespace cjm::synchro
+{
+	// synchro_vault with asynchronous delegation.  submit(fn) and post(fn) enqueue fn on a
+	// lock-free queue and return immediately; the vault's executor thread takes the mutex and
+	// runs queued closures in batches, so the protected data stays in that thread's cache while
+	// callers pipeline updates.  lock() and the rest of the synchro_vault interface remain
+	// available; the executor simply competes for the mutex like any other holder.
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class delegating_vault : public synchro_vault<TLocked, TMutex, Level>
+	{
+		using base_t = synchro_vault<TLocked, TMutex, Level>;
+	public:
+		using locked_t = typename base_t::locked_t;
+
+		delegating_vault() requires (std::is_default_constructible_v<locked_t>) : base_t{} {}
+		using base_t::base_t;
+		delegating_vault(const delegating_vault& other) = delete;
+		delegating_vault(delegating_vault&& other) noexcept = delete;
+		delegating_vault& operator=(const delegating_vault& other) = delete;
+		delegating_vault& operator=(delegating_vault&& other) noexcept = delete;
+		// Runs everything still queued before returning, so no future is left unsatisfied.
+		~delegating_vault()
+		{
+			m_executor.request_stop();
+			wake_executor();
+			m_executor.join();
+		}
+
+		template<std::invocable<locked_t&> TFunction>
+			requires (std::move_constructible<TFunction> && !std::is_reference_v<std::invoke_result_t<TFunction&, locked_t&>>)
+		[[nodiscard]] auto submit(TFunction function) -> std::future<std::invoke_result_t<TFunction&, locked_t&>>
+		{
+			auto task = std::make_unique<detail::promised_task<locked_t, TFunction>>(std::move(function));
+			auto future = task->get_future();
+			m_queue.push(std::move(task));
+			wake_executor();
+			return future;
+		}
+
+		template<std::invocable<locked_t&> TFunction>
+			requires (std::move_constructible<TFunction>)
+		void post(TFunction function)
+		{
+			m_queue.push(std::make_unique<detail::posted_task<locked_t, TFunction>>(std::move(function)));
+			wake_executor();
+		}
+
+	private:
+		void wake_executor() noexcept
+		{
+			m_wake.fetch_add(1, std::memory_order_release);
+			m_wake.notify_one();
+		}
+
+		void execute(std::stop_token stop)
+		{
+			for (;;)
+			{
+				const std::uint32_t generation = m_wake.load(std::memory_order_acquire);
+				if (!m_queue.empty())
+				{
+					// One batch per hold, so lock() callers get the mutex between batches.
+					auto ptr = this->lock();
+					m_queue.drain(*ptr);
+					continue;
+				}
+				if (stop.stop_requested())
+				{
+					return;
+				}
+				m_wake.wait(generation, std::memory_order_acquire);
+			}
+		}
+
+		detail::delegation_queue<locked_t> m_queue;
+		std::atomic<std::uint32_t> m_wake{ 0 };
+		std::jthread m_executor{ [this](std::stop_token stop) { execute(std::move(stop)); } };
+	};
+}
+#endif
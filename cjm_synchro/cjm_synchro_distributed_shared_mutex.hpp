@@ -0,0 +1,151 @@
+#ifndef CJM_SYNCHRO_DISTRIBUTED_SHARED_MUTEX_HPP_
+#define CJM_SYNCHRO_DISTRIBUTED_SHARED_MUTEX_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro_parking_lot.hpp"
+#include "cjm_synchro_adaptive_mutex.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <thread>
+
+namespace cjm::synchro
+{
+	// Reader-writer mutex whose readers never write a shared line: each reader bumps a padded
+	// counter picked by hashing its thread, then checks the writer flag.  A writer serializes on
+	// an adaptive_timed_mutex, raises the flag and waits for every counter to drain.  Readers that
+	// see the flag back out and park until the writer leaves, so writers are preferred.  The
+	// writer parks once its spin budget runs out, and departing readers wake it.  Shared
+	// ownership may be released on any thread: the writer waits for the sum of the counters,
+	// not for each one, so a reader that departs on another thread's counter still cancels out.
+	class distributed_shared_mutex
+	{
+	public:
+		distributed_shared_mutex() noexcept = default;
+		distributed_shared_mutex(const distributed_shared_mutex& other) = delete;
+		distributed_shared_mutex(distributed_shared_mutex&& other) noexcept = delete;
+		distributed_shared_mutex& operator=(const distributed_shared_mutex& other) = delete;
+		distributed_shared_mutex& operator=(distributed_shared_mutex&& other) noexcept = delete;
+		~distributed_shared_mutex() = default;
+
+		void lock()
+		{
+			m_writer_mutex.lock();
+			m_state.fetch_or(writer_bit, std::memory_order_seq_cst);
+			m_readers.wait_until_empty();
+		}
+
+		[[nodiscard]] bool try_lock() noexcept
+		{
+			if (!m_writer_mutex.try_lock())
+			{
+				return false;
+			}
+			m_state.fetch_or(writer_bit, std::memory_order_seq_cst);
+			if (!m_readers.is_empty())
+			{
+				unlock();
+				return false;
+			}
+			return true;
+		}
+
+		template<typename TRep, typename TPeriod>
+		[[nodiscard]] bool try_lock_for(const std::chrono::duration<TRep, TPeriod>& duration)
+		{
+			return try_lock_until(std::chrono::steady_clock::now() + duration);
+		}
+
+		template<typename TClock, typename TDuration>
+		[[nodiscard]] bool try_lock_until(const std::chrono::time_point<TClock, TDuration>& deadline)
+		{
+			if (!m_writer_mutex.try_lock_until(deadline))
+			{
+				return false;
+			}
+			m_state.fetch_or(writer_bit, std::memory_order_seq_cst);
+			if (!m_readers.wait_until_empty(deadline))
+			{
+				unlock();
+				return false;
+			}
+			return true;
+		}
+
+		void unlock()
+		{
+			if ((m_state.exchange(0, std::memory_order_seq_cst) & readers_parked_bit) != 0)
+			{
+				detail::parking_lot::unpark_all(&m_state);
+			}
+			m_writer_mutex.unlock();
+		}
+
+		void lock_shared()
+		{
+			const std::size_t shard = detail::sharded_read_indicator::local_shard();
+			while (!try_arrive(shard))
+			{
+				detail::parking_lot::park(&m_state, [this] { return reader_must_park(); }, [] {});
+			}
+		}
+
+		[[nodiscard]] bool try_lock_shared() noexcept
+		{
+			return try_arrive(detail::sharded_read_indicator::local_shard());
+		}
+
+		template<typename TRep, typename TPeriod>
+		[[nodiscard]] bool try_lock_shared_for(const std::chrono::duration<TRep, TPeriod>& duration)
+		{
+			return try_lock_shared_until(std::chrono::steady_clock::now() + duration);
+		}
+
+		template<typename TClock, typename TDuration>
+		[[nodiscard]] bool try_lock_shared_until(const std::chrono::time_point<TClock, TDuration>& deadline)
+		{
+			const std::size_t shard = detail::sharded_read_indicator::local_shard();
+			while (!try_arrive(shard))
+			{
+				if (detail::parking_lot::park_until(&m_state, [this] { return reader_must_park(); }, [] {}, deadline) == detail::parking_lot::park_result::timed_out)
+				{
+					return try_arrive(shard);
+				}
+			}
+			return true;
+		}
+
+		void unlock_shared() noexcept
+		{
+			m_readers.depart(detail::sharded_read_indicator::local_shard());
+		}
+
+	private:
+		static constexpr std::uint32_t writer_bit = 0x01;
+		static constexpr std::uint32_t readers_parked_bit = 0x02;
+
+		bool try_arrive(std::size_t shard) noexcept
+		{
+			m_readers.arrive(shard);
+			if ((m_state.load(std::memory_order_seq_cst) & writer_bit) == 0)
+			{
+				return true;
+			}
+			m_readers.depart(shard);
+			return false;
+		}
+
+		// Runs under the bucket lock: a writer that clears the flag after this point sees the
+		// parked bit and unparks everyone on the bucket.
+		bool reader_must_park() noexcept
+		{
+			return (m_state.fetch_or(readers_parked_bit, std::memory_order_seq_cst) & writer_bit) != 0;
+		}
+
+		std::atomic<std::uint32_t> m_state{ 0 };
+		adaptive_timed_mutex m_writer_mutex;
+		detail::sharded_read_indicator m_readers;
+	};
+}
+#endif
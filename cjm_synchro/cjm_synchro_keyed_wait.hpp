@@ -0,0 +1,279 @@
+#ifndef CJM_SYNCHRO_KEYED_WAIT_HPP_
+#define CJM_SYNCHRO_KEYED_WAIT_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro_parking_lot.hpp"
+#include "cjm_synchro.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace cjm::synchro
+{
+	template<typename TLocked, typename TKey, concepts::mutex TMutex = std::mutex, concepts::mutex_level Level = concepts::level_v<TMutex>>
+	class keyed_vault;
+}
+
+namespace cjm::synchro::detail
+{
+	// A thread blocked in keyed_vault::wait.  It lives on the waiter's stack and is linked into
+	// the registry only while the vault's mutex is held, so the registry needs no lock of its
+	// own.  The predicate is type-erased through a function pointer; it is only ever called by a
+	// notifier holding the vault's mutex.  A notifier that unlinks a waiter owns it until it
+	// sets signaled, which may be after the mutex is released, so an unlinked waiter must not
+	// return before seeing signaled.
+	template<typename TLocked, typename TKey>
+	struct keyed_waiter
+	{
+		using test_fn_t = bool (*)(const void* predicate, const TLocked& locked);
+
+		const TKey* key;
+		const void* predicate;
+		test_fn_t test;
+		keyed_waiter* prev{ nullptr };
+		keyed_waiter* next{ nullptr };
+		keyed_waiter* next_selected{ nullptr };
+		bool linked{ false };
+		std::atomic<bool> signaled{ false };
+
+		// Parked by address; a late unpark after the waiter has returned is harmless.
+		void signal() noexcept
+		{
+			signaled.store(true, std::memory_order_release);
+			parking_lot::unpark_one(this, [](parking_lot::unpark_result) {});
+		}
+	};
+
+	template<typename TLocked, typename TKey>
+	class keyed_wait_registry
+	{
+	public:
+		using waiter_t = keyed_waiter<TLocked, TKey>;
+		static constexpr std::size_t bucket_count = 64;
+
+		keyed_wait_registry() noexcept = default;
+		keyed_wait_registry(const keyed_wait_registry& other) = delete;
+		keyed_wait_registry(keyed_wait_registry&& other) noexcept = delete;
+		keyed_wait_registry& operator=(const keyed_wait_registry& other) = delete;
+		keyed_wait_registry& operator=(keyed_wait_registry&& other) noexcept = delete;
+		~keyed_wait_registry()
+		{
+			assert(std::all_of(m_buckets.begin(), m_buckets.end(), [](const waiter_t* head) { return head == nullptr; }));
+		}
+
+		void link(waiter_t& waiter) noexcept
+		{
+			assert(!waiter.linked);
+			waiter_t*& head = bucket_for(*waiter.key);
+			waiter.prev = nullptr;
+			waiter.next = head;
+			if (head != nullptr)
+			{
+				head->prev = &waiter;
+			}
+			head = &waiter;
+			waiter.linked = true;
+		}
+
+		void unlink(waiter_t& waiter) noexcept
+		{
+			assert(waiter.linked);
+			if (waiter.prev != nullptr)
+			{
+				waiter.prev->next = waiter.next;
+			}
+			else
+			{
+				bucket_for(*waiter.key) = waiter.next;
+			}
+			if (waiter.next != nullptr)
+			{
+				waiter.next->prev = waiter.prev;
+			}
+			waiter.prev = waiter.next = nullptr;
+			waiter.linked = false;
+		}
+
+		// Unlinks every waiter on key whose predicate holds for locked and chains them through
+		// next_selected for the caller to signal.  Waiters on other keys are never touched.  All
+		// predicates are tested before anything is unlinked, so if one throws the registry is
+		// left as it was.
+		[[nodiscard]] waiter_t* select(const TKey& key, const TLocked& locked)
+		{
+			waiter_t* selected = nullptr;
+			for (waiter_t* waiter = bucket_for(key); waiter != nullptr; waiter = waiter->next)
+			{
+				if (*waiter->key == key && waiter->test(waiter->predicate, locked))
+				{
+					waiter->next_selected = selected;
+					selected = waiter;
+				}
+			}
+			for (waiter_t* waiter = selected; waiter != nullptr; waiter = waiter->next_selected)
+			{
+				unlink(*waiter);
+			}
+			return selected;
+		}
+
+		// Each waiter may return as soon as it is signalled, so its successor is read first.
+		static std::size_t signal_all(waiter_t* selected) noexcept
+		{
+			std::size_t woken = 0;
+			while (selected != nullptr)
+			{
+				waiter_t* next = selected->next_selected;
+				selected->signal();
+				selected = next;
+				++woken;
+			}
+			return woken;
+		}
+
+	private:
+		waiter_t*& bucket_for(const TKey& key) noexcept
+		{
+			return m_buckets[std::hash<TKey>{}(key) % bucket_count];
+		}
+
+		std::array<waiter_t*, bucket_count> m_buckets{};
+	};
+}
+
+namespace cjm::synchro
+{
+	// synchro_vault whose waiters wait on a key and a predicate over the protected data instead
+	// of on the shared condition variable.  A notifier evaluates, under the lock, only the
+	// predicates registered for the key it names and wakes just the waiters whose predicate now
+	// holds; update(key, fn) goes further and wakes them after releasing the mutex, so a woken
+	// thread finds it free rather than blocking on it straight away.  The ordinary wait/notify
+	// interface of synchro_vault is untouched and independent.
+	template<typename TLocked, typename TKey, concepts::mutex TMutex, concepts::mutex_level Level>
+	class keyed_vault : public synchro_vault<TLocked, TMutex, Level>
+	{
+		using base_t = synchro_vault<TLocked, TMutex, Level>;
+	public:
+		using locked_t = typename base_t::locked_t;
+		using locked_ptr_t = typename base_t::locked_ptr_t;
+		using key_t = TKey;
+
+		keyed_vault() requires (std::is_default_constructible_v<locked_t>) : base_t{} {}
+		using base_t::base_t;
+		keyed_vault(const keyed_vault& other) = delete;
+		keyed_vault(keyed_vault&& other) noexcept = delete;
+		keyed_vault& operator=(const keyed_vault& other) = delete;
+		keyed_vault& operator=(keyed_vault&& other) noexcept = delete;
+		~keyed_vault() = default;
+
+		// ptr must be a lock on this vault.  Returns with the lock held and predicate(*ptr) true.
+		template<std::predicate<const locked_t&> TPredicate>
+		void wait(locked_ptr_t& ptr, const key_t& key, TPredicate predicate)
+		{
+			while (!std::invoke(predicate, std::as_const(*ptr)))
+			{
+				auto waiter = make_waiter(key, predicate);
+				m_registry.link(waiter);
+				{
+					auto unlocked = ptr.scoped_unlock();
+					park_until_signaled(waiter);
+				}
+			}
+		}
+
+		// As wait, but gives up at deadline; returns predicate(*ptr) with the lock held.
+		template<typename TClock, typename TDuration, std::predicate<const locked_t&> TPredicate>
+		bool wait_until(locked_ptr_t& ptr, const key_t& key, const std::chrono::time_point<TClock, TDuration>& deadline, TPredicate predicate)
+		{
+			while (!std::invoke(predicate, std::as_const(*ptr)))
+			{
+				if (TClock::now() >= deadline)
+				{
+					return false;
+				}
+				auto waiter = make_waiter(key, predicate);
+				m_registry.link(waiter);
+				{
+					auto unlocked = ptr.scoped_unlock();
+					while (!waiter.signaled.load(std::memory_order_acquire) &&
+						detail::parking_lot::park_until(&waiter, [&waiter] { return !waiter.signaled.load(std::memory_order_relaxed); },
+							[] {}, deadline) != detail::parking_lot::park_result::timed_out) {}
+				}
+				if (waiter.linked)
+				{
+					m_registry.unlink(waiter);
+				}
+				else
+				{
+					// Selected after timing out; update() signals only once it has released the
+					// mutex, and until then its signal_all may still read this waiter.
+					park_until_signaled(waiter);
+				}
+			}
+			return true;
+		}
+
+		template<typename TRep, typename TPeriod, std::predicate<const locked_t&> TPredicate>
+		bool wait_for(locked_ptr_t& ptr, const key_t& key, const std::chrono::duration<TRep, TPeriod>& d, TPredicate predicate)
+		{
+			return wait_until(ptr, key, std::chrono::steady_clock::now() + d, std::move(predicate));
+		}
+
+		// ptr must be a lock on this vault.  Wakes the waiters on key whose predicate holds now;
+		// they run once ptr is released.  Returns how many were woken.
+		std::size_t notify(const locked_ptr_t& ptr, const key_t& key)
+		{
+			return registry_t::signal_all(m_registry.select(key, std::as_const(*ptr)));
+		}
+
+		// Takes the lock, wakes the waiters on key whose predicate holds, and releases the lock
+		// before they are signalled.
+		std::size_t notify(const key_t& key)
+		{
+			return update(key, [](locked_t&) {});
+		}
+
+		// Applies fn to the data under the lock and then notifies key as notify(key) does.
+		template<std::invocable<locked_t&> TFunction>
+		std::size_t update(const key_t& key, TFunction fn)
+		{
+			typename registry_t::waiter_t* selected = nullptr;
+			{
+				auto ptr = this->lock();
+				std::invoke(fn, *ptr);
+				selected = m_registry.select(key, std::as_const(*ptr));
+			}
+			return registry_t::signal_all(selected);
+		}
+
+	private:
+		using registry_t = detail::keyed_wait_registry<locked_t, key_t>;
+
+		static void park_until_signaled(typename registry_t::waiter_t& waiter)
+		{
+			while (!waiter.signaled.load(std::memory_order_acquire))
+			{
+				detail::parking_lot::park(&waiter, [&waiter] { return !waiter.signaled.load(std::memory_order_relaxed); }, [] {});
+			}
+		}
+
+		template<typename TPredicate>
+		static typename registry_t::waiter_t make_waiter(const key_t& key, const TPredicate& predicate) noexcept
+		{
+			return typename registry_t::waiter_t{ &key, std::addressof(predicate),
+				[](const void* p, const locked_t& locked) -> bool
+				{
+					return std::invoke(*static_cast<const TPredicate*>(p), locked);
+				} };
+		}
+
+		registry_t m_registry;
+	};
+}
+#endif
@@ -0,0 +1,326 @@
+#ifndef CJM_SYNCHRO_LEFT_RIGHT_HPP_
+#define CJM_SYNCHRO_LEFT_RIGHT_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cjm::synchro
+{
+	template<typename TLocked, concepts::mutex TMutex = std::mutex>
+	class left_right_vault;
+
+	template<typename TLocked, concepts::mutex TMutex = std::mutex>
+	class left_right_read_ptr;
+
+	template<typename TLocked, concepts::mutex TMutex = std::mutex>
+	class left_right_write_ptr;
+}
+
+namespace cjm::synchro::detail
+{
+	// A mutation that throws leaves the two instances different.  The vault puts them back in
+	// step by copying the published instance over the other, so a type that cannot be copy
+	// assigned only accepts mutations that cannot throw.
+	template<typename TMutator, typename TLocked>
+	concept left_right_mutator = std::invocable<TMutator&, TLocked&> &&
+		(std::is_copy_assignable_v<TLocked> || std::is_nothrow_invocable_v<TMutator&, TLocked&>);
+
+	template<typename TLocked>
+	class left_right_mutation
+	{
+	public:
+		left_right_mutation() noexcept = default;
+		left_right_mutation(const left_right_mutation& other) = delete;
+		left_right_mutation(left_right_mutation&& other) noexcept = delete;
+		left_right_mutation& operator=(const left_right_mutation& other) = delete;
+		left_right_mutation& operator=(left_right_mutation&& other) noexcept = delete;
+		virtual ~left_right_mutation() = default;
+		virtual void apply(TLocked& instance) = 0;
+	};
+
+	template<typename TLocked, typename TMutator>
+	class left_right_mutation_impl final : public left_right_mutation<TLocked>
+	{
+	public:
+		explicit left_right_mutation_impl(TMutator mutator) : m_mutator{ std::move(mutator) } {}
+		void apply(TLocked& instance) override { std::invoke(m_mutator, instance); }
+	private:
+		TMutator m_mutator;
+	};
+}
+
+namespace cjm::synchro
+{
+	template<typename TLocked, concepts::mutex TMutex>
+	class left_right_read_ptr
+	{
+		using vault_t = left_right_vault<TLocked, TMutex>;
+		friend vault_t;
+	public:
+		using locked_t = std::remove_reference_t<TLocked>;
+		using const_locked_t = std::add_const_t<locked_t>;
+
+		left_right_read_ptr() noexcept = default;
+		left_right_read_ptr(const left_right_read_ptr& other) = delete;
+		left_right_read_ptr(left_right_read_ptr&& other) noexcept
+			: m_vault{ std::exchange(other.m_vault, nullptr) }, m_datum{ std::exchange(other.m_datum, nullptr) },
+			m_version{ other.m_version }, m_shard{ other.m_shard } {}
+		left_right_read_ptr& operator=(const left_right_read_ptr& other) = delete;
+		left_right_read_ptr& operator=(left_right_read_ptr&& other) noexcept
+		{
+			if (this != &other)
+			{
+				release();
+				m_vault = std::exchange(other.m_vault, nullptr);
+				m_datum = std::exchange(other.m_datum, nullptr);
+				m_version = other.m_version;
+				m_shard = other.m_shard;
+			}
+			return *this;
+		}
+		~left_right_read_ptr() { release(); }
+
+		[[nodiscard]] const_locked_t* operator->() const noexcept { assert(m_datum != nullptr); return m_datum; }
+		[[nodiscard]] const_locked_t& operator*() const noexcept { assert(m_datum != nullptr); return *m_datum; }
+		[[nodiscard]] explicit operator bool() const noexcept { return m_datum != nullptr; }
+
+		void release() noexcept
+		{
+			if (m_vault != nullptr)
+			{
+				m_vault->m_read_indicators[m_version].depart(m_shard);
+				m_vault = nullptr;
+				m_datum = nullptr;
+			}
+		}
+
+	private:
+		left_right_read_ptr(const vault_t* vault, const_locked_t* datum, std::size_t version, std::size_t shard) noexcept
+			: m_vault{ vault }, m_datum{ datum }, m_version{ version }, m_shard{ shard } {}
+
+		const vault_t* m_vault{ nullptr };
+		const_locked_t* m_datum{ nullptr };
+		std::size_t m_version{ 0 };
+		std::size_t m_shard{ 0 };
+	};
+
+	// Exclusive writer handle.  Each modify() runs immediately against the standby instance and
+	// is recorded; releasing the pointer publishes the standby instance to readers, waits for the
+	// readers of the old one to drain and then replays the recorded mutations on it.  A mutation
+	// therefore runs exactly once per instance and must construct (not move in) its payload.
+	// If a mutation throws from modify(), the exception propagates and whatever it changed is
+	// published with the rest; if it throws during the replay, the exception is swallowed.
+	// Either way the old instance is then resynchronized by copy assignment from the published
+	// one instead of by replay (see detail::left_right_mutator).
+	template<typename TLocked, concepts::mutex TMutex>
+	class left_right_write_ptr
+	{
+		using vault_t = left_right_vault<TLocked, TMutex>;
+		friend vault_t;
+	public:
+		using locked_t = std::remove_reference_t<TLocked>;
+		using const_locked_t = std::add_const_t<locked_t>;
+		using lock_t = std::unique_lock<TMutex>;
+
+		left_right_write_ptr() noexcept = default;
+		left_right_write_ptr(const left_right_write_ptr& other) = delete;
+		left_right_write_ptr(left_right_write_ptr&& other) noexcept
+			: m_lock{ std::move(other.m_lock) }, m_vault{ std::exchange(other.m_vault, nullptr) },
+			m_mutations{ std::move(other.m_mutations) }, m_diverged{ std::exchange(other.m_diverged, false) } {}
+		left_right_write_ptr& operator=(const left_right_write_ptr& other) = delete;
+		left_right_write_ptr& operator=(left_right_write_ptr&& other) noexcept
+		{
+			if (this != &other)
+			{
+				release();
+				m_lock = std::move(other.m_lock);
+				m_vault = std::exchange(other.m_vault, nullptr);
+				m_mutations = std::move(other.m_mutations);
+				m_diverged = std::exchange(other.m_diverged, false);
+			}
+			return *this;
+		}
+		~left_right_write_ptr() { release(); }
+
+		[[nodiscard]] const_locked_t* operator->() const noexcept { return std::addressof(m_vault->standby()); }
+		[[nodiscard]] const_locked_t& operator*() const noexcept { return m_vault->standby(); }
+		[[nodiscard]] explicit operator bool() const noexcept { return m_lock.owns_lock(); }
+
+		template<detail::left_right_mutator<locked_t> TMutator>
+		void modify(TMutator mutator)
+		{
+			assert(m_lock.owns_lock() && m_vault != nullptr);
+			auto mutation = std::make_unique<detail::left_right_mutation_impl<locked_t, TMutator>>(std::move(mutator));
+			m_mutations.reserve(m_mutations.size() + 1);
+			try
+			{
+				mutation->apply(m_vault->standby());
+			}
+			catch (...)
+			{
+				m_diverged = true;
+				throw;
+			}
+			m_mutations.emplace_back(std::move(mutation));
+		}
+
+		void release() noexcept
+		{
+			if (m_vault != nullptr)
+			{
+				assert(m_lock.owns_lock());
+				if (!m_mutations.empty() || m_diverged)
+				{
+					m_vault->publish_and_replay(m_mutations, m_diverged);
+					m_mutations.clear();
+					m_diverged = false;
+				}
+				m_vault = nullptr;
+				m_lock.unlock();
+			}
+		}
+
+	private:
+		left_right_write_ptr(lock_t lock, vault_t* vault) : m_lock{ std::move(lock) }, m_vault{ vault }, m_mutations{} {}
+
+		lock_t m_lock;
+		vault_t* m_vault{ nullptr };
+		std::vector<std::unique_ptr<detail::left_right_mutation<locked_t>>> m_mutations;
+		bool m_diverged{ false };
+	};
+
+	// Left-right vault: two copies of TLocked.  Readers never wait and never take the mutex;
+	// they announce themselves on a sharded read indicator and read whichever copy is currently
+	// published.  Writers serialize on TMutex and apply each mutation to both copies in turn.
+	template<typename TLocked, concepts::mutex TMutex>
+	class left_right_vault
+	{
+		friend class left_right_read_ptr<TLocked, TMutex>;
+		friend class left_right_write_ptr<TLocked, TMutex>;
+	public:
+		using locked_t = std::remove_reference_t<TLocked>;
+		using const_locked_t = std::add_const_t<locked_t>;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using read_ptr_t = left_right_read_ptr<TLocked, TMutex>;
+		using write_ptr_t = left_right_write_ptr<TLocked, TMutex>;
+
+		left_right_vault() requires (std::is_default_constructible_v<locked_t>)
+			: m_instances{}, m_published{ 0 }, m_version{ 0 } {}
+		template<typename...TArgs>
+			requires (sizeof...(TArgs) > 0 && std::constructible_from<locked_t, const TArgs&...>)
+		explicit left_right_vault(const TArgs&... args)
+			: m_instances{ locked_t(args...), locked_t(args...) }, m_published{ 0 }, m_version{ 0 } {}
+		left_right_vault(const left_right_vault& other) = delete;
+		left_right_vault(left_right_vault&& other) noexcept = delete;
+		left_right_vault& operator=(const left_right_vault& other) = delete;
+		left_right_vault& operator=(left_right_vault&& other) noexcept = delete;
+		~left_right_vault() = default;
+
+		[[nodiscard]] read_ptr_t lock_shared() const noexcept
+		{
+			const std::size_t shard = detail::sharded_read_indicator::local_shard();
+			const std::size_t version = m_version.load(std::memory_order_seq_cst);
+			m_read_indicators[version].arrive(shard);
+			const std::size_t published = m_published.load(std::memory_order_seq_cst);
+			return read_ptr_t{ this, std::addressof(m_instances[published]), version, shard };
+		}
+
+		// By value: once the read pointer is gone a writer may replay mutations on the instance.
+		template<std::invocable<const locked_t&> TReader>
+			requires (!std::is_reference_v<std::invoke_result_t<TReader&, const locked_t&>>)
+		auto read(TReader reader) const
+		{
+			const read_ptr_t ptr = lock_shared();
+			return std::invoke(reader, *ptr);
+		}
+
+		[[nodiscard]] auto copy_locked_datum() const -> locked_t
+			requires (std::copy_constructible<locked_t>)
+		{
+			const read_ptr_t ptr = lock_shared();
+			return *ptr;
+		}
+
+		[[nodiscard]] write_ptr_t lock()
+		{
+			return write_ptr_t{ lock_t{ m_mutex }, this };
+		}
+
+		template<detail::left_right_mutator<locked_t> TMutator>
+		void modify(TMutator mutator)
+		{
+			write_ptr_t ptr = lock();
+			ptr.modify(std::move(mutator));
+		}
+
+		void assign_locked_datum(const locked_t& new_datum)
+			requires (std::is_copy_assignable_v<locked_t>)
+		{
+			modify([&new_datum](locked_t& instance) { instance = new_datum; });
+		}
+
+	private:
+		[[nodiscard]] locked_t& standby() noexcept
+		{
+			return m_instances[1 - m_published.load(std::memory_order_relaxed)];
+		}
+
+		// Noexcept because readers may already be on the new instance: there is no undoing the
+		// publication.  A copy assignment that throws while resynchronizing terminates.
+		void publish_and_replay(std::vector<std::unique_ptr<detail::left_right_mutation<locked_t>>>& mutations,
+			bool diverged) noexcept
+		{
+			const std::size_t published = m_published.load(std::memory_order_relaxed);
+			m_published.store(1 - published, std::memory_order_seq_cst);
+
+			const std::size_t previous_version = m_version.load(std::memory_order_relaxed);
+			const std::size_t next_version = 1 - previous_version;
+			m_read_indicators[next_version].wait_until_empty();
+			m_version.store(next_version, std::memory_order_seq_cst);
+			m_read_indicators[previous_version].wait_until_empty();
+
+			if (diverged || !replay(m_instances[published], mutations))
+			{
+				if constexpr (std::is_copy_assignable_v<locked_t>)
+				{
+					m_instances[published] = m_instances[1 - published];
+				}
+			}
+		}
+
+		// Returns false if a mutation threw; only copy-assignable types can get one that does.
+		static bool replay(locked_t& instance, std::vector<std::unique_ptr<detail::left_right_mutation<locked_t>>>& mutations) noexcept
+		{
+			try
+			{
+				for (auto& mutation : mutations)
+				{
+					mutation->apply(instance);
+				}
+				return true;
+			}
+			catch (...)
+			{
+				return false;
+			}
+		}
+
+		mutable mutex_t m_mutex;
+		std::array<locked_t, 2> m_instances;
+		std::atomic<std::size_t> m_published;
+		std::atomic<std::size_t> m_version;
+		mutable std::array<detail::sharded_read_indicator, 2> m_read_indicators;
+	};
+}
+#endif
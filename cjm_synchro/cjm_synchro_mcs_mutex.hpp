@@ -0,0 +1,195 @@
+#ifndef CJM_SYNCHRO_MCS_MUTEX_HPP_
+#define CJM_SYNCHRO_MCS_MUTEX_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro_parking_lot.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace cjm::synchro::detail
+{
+	struct alignas(cache_line_size) mcs_node
+	{
+		static constexpr std::uint32_t granted = 0;
+		static constexpr std::uint32_t waiting = 1;
+		static constexpr std::uint32_t parked = 2;
+
+		std::atomic<mcs_node*> next{ nullptr };
+		std::atomic<std::uint32_t> state{ waiting };
+	};
+
+	// Queue nodes are owned by the thread that enqueues them.  A node is unreferenced as soon as
+	// its owner's unlock has handed off, so each thread recycles its own nodes; a thread needs
+	// one node per MCS lock it holds at the same time.
+	class mcs_node_pool
+	{
+	public:
+		mcs_node_pool() = default;
+		mcs_node_pool(const mcs_node_pool& other) = delete;
+		mcs_node_pool(mcs_node_pool&& other) noexcept = delete;
+		mcs_node_pool& operator=(const mcs_node_pool& other) = delete;
+		mcs_node_pool& operator=(mcs_node_pool&& other) noexcept = delete;
+		~mcs_node_pool()
+		{
+			for (mcs_node* node : m_free)
+			{
+				delete node;
+			}
+		}
+
+		[[nodiscard]] static mcs_node* acquire()
+		{
+			mcs_node_pool& pool = local();
+			mcs_node* node = nullptr;
+			if (pool.m_free.empty())
+			{
+				node = new mcs_node{};
+			}
+			else
+			{
+				node = pool.m_free.back();
+				pool.m_free.pop_back();
+			}
+			node->next.store(nullptr, std::memory_order_relaxed);
+			node->state.store(mcs_node::waiting, std::memory_order_relaxed);
+			return node;
+		}
+
+		static void release(mcs_node* node)
+		{
+			local().m_free.push_back(node);
+		}
+
+	private:
+		static mcs_node_pool& local()
+		{
+			thread_local mcs_node_pool pool;
+			return pool;
+		}
+
+		std::vector<mcs_node*> m_free;
+	};
+
+	// MCS queue lock.  Each waiter spins only on the state word of its own cache-line-sized
+	// node and ownership passes in FIFO order.  A waiter that has not been granted the lock
+	// within spin_limit pauses yields between polls or, with ParkAfterSpin, parks on its node
+	// and is unparked by its predecessor, so oversubscribed machines do not stall a timeslice
+	// per handoff.
+	template<bool ParkAfterSpin>
+	class basic_mcs_mutex
+	{
+	public:
+		static constexpr unsigned spin_limit = 1024;
+
+		basic_mcs_mutex() noexcept = default;
+		basic_mcs_mutex(const basic_mcs_mutex& other) = delete;
+		basic_mcs_mutex(basic_mcs_mutex&& other) noexcept = delete;
+		basic_mcs_mutex& operator=(const basic_mcs_mutex& other) = delete;
+		basic_mcs_mutex& operator=(basic_mcs_mutex&& other) noexcept = delete;
+		~basic_mcs_mutex() = default;
+
+		void lock()
+		{
+			mcs_node* node = mcs_node_pool::acquire();
+			mcs_node* predecessor = m_tail.exchange(node, std::memory_order_acq_rel);
+			if (predecessor != nullptr)
+			{
+				predecessor->next.store(node, std::memory_order_release);
+				wait_for_grant(node);
+			}
+			m_holder = node;
+		}
+
+		[[nodiscard]] bool try_lock()
+		{
+			if (m_tail.load(std::memory_order_relaxed) != nullptr)
+			{
+				return false;
+			}
+			mcs_node* node = mcs_node_pool::acquire();
+			mcs_node* expected = nullptr;
+			if (m_tail.compare_exchange_strong(expected, node, std::memory_order_acquire, std::memory_order_relaxed))
+			{
+				m_holder = node;
+				return true;
+			}
+			mcs_node_pool::release(node);
+			return false;
+		}
+
+		void unlock()
+		{
+			mcs_node* node = m_holder;
+			assert(node != nullptr);
+			m_holder = nullptr;
+			mcs_node* successor = node->next.load(std::memory_order_acquire);
+			if (successor == nullptr)
+			{
+				mcs_node* expected = node;
+				if (m_tail.compare_exchange_strong(expected, nullptr, std::memory_order_release, std::memory_order_relaxed))
+				{
+					mcs_node_pool::release(node);
+					return;
+				}
+				while ((successor = node->next.load(std::memory_order_acquire)) == nullptr)
+				{
+					cpu_relax();
+				}
+			}
+			grant(successor);
+			mcs_node_pool::release(node);
+		}
+
+	private:
+		static void wait_for_grant(mcs_node* node)
+		{
+			for (unsigned spins = 0; node->state.load(std::memory_order_acquire) != mcs_node::granted; ++spins)
+			{
+				if (spins < spin_limit)
+				{
+					cpu_relax();
+				}
+				else if constexpr (ParkAfterSpin)
+				{
+					std::uint32_t expected = mcs_node::waiting;
+					node->state.compare_exchange_strong(expected, mcs_node::parked, std::memory_order_acq_rel, std::memory_order_acquire);
+					parking_lot::park(node, [node] { return node->state.load(std::memory_order_relaxed) == mcs_node::parked; }, [] {});
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		// The successor may run, release and recycle its node the moment it observes the grant;
+		// the parking lot only uses the address as a key, so a late unpark is at worst spurious.
+		static void grant(mcs_node* successor)
+		{
+			if constexpr (ParkAfterSpin)
+			{
+				if (successor->state.exchange(mcs_node::granted, std::memory_order_release) == mcs_node::parked)
+				{
+					parking_lot::unpark_one(successor, [](parking_lot::unpark_result) {});
+				}
+			}
+			else
+			{
+				successor->state.store(mcs_node::granted, std::memory_order_release);
+			}
+		}
+
+		std::atomic<mcs_node*> m_tail{ nullptr };
+		mcs_node* m_holder{ nullptr };
+	};
+}
+
+namespace cjm::synchro
+{
+	using mcs_mutex = detail::basic_mcs_mutex<false>;
+	using mcs_parking_mutex = detail::basic_mcs_mutex<true>;
+}
+#endif
@@ -0,0 +1,214 @@
+#ifndef CJM_SYNCHRO_PARKING_LOT_HPP_
+#define CJM_SYNCHRO_PARKING_LOT_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+namespace cjm::synchro
+{
+	// Condition variable whose entire state is one byte.  Waiters park on its address; the
+	// byte only records whether anyone might be parked so that notifying an idle condition
+	// never touches the parking lot.
+	class parking_condition
+	{
+	public:
+		parking_condition() noexcept = default;
+		parking_condition(const parking_condition& other) = delete;
+		parking_condition(parking_condition&& other) noexcept = delete;
+		parking_condition& operator=(const parking_condition& other) = delete;
+		parking_condition& operator=(parking_condition&& other) noexcept = delete;
+		~parking_condition() = default;
+
+		void notify_one() noexcept
+		{
+			if (m_has_waiters.load(std::memory_order_seq_cst) == 0)
+			{
+				return;
+			}
+			detail::parking_lot::unpark_one(this, [this](detail::parking_lot::unpark_result result)
+			{
+				if (!result.may_have_more)
+				{
+					m_has_waiters.store(0, std::memory_order_relaxed);
+				}
+			});
+		}
+
+		void notify_all() noexcept
+		{
+			if (m_has_waiters.load(std::memory_order_seq_cst) == 0)
+			{
+				return;
+			}
+			m_has_waiters.store(0, std::memory_order_relaxed);
+			detail::parking_lot::unpark_all(this);
+		}
+
+		template<concepts::basic_lockable TLock>
+		void wait(TLock& lock)
+		{
+			detail::parking_lot::park(this, enqueue_validator(), [&lock] { lock.unlock(); });
+			lock.lock();
+		}
+
+		template<concepts::basic_lockable TLock, std::predicate TPredicate>
+		void wait(TLock& lock, TPredicate predicate)
+		{
+			while (!predicate())
+			{
+				wait(lock);
+			}
+		}
+
+		template<concepts::basic_lockable TLock, typename TClock, typename TDuration>
+		std::cv_status wait_until(TLock& lock, const std::chrono::time_point<TClock, TDuration>& deadline)
+		{
+			const auto result = detail::parking_lot::park_until(this, enqueue_validator(), [&lock] { lock.unlock(); }, deadline);
+			lock.lock();
+			return result == detail::parking_lot::park_result::timed_out ? std::cv_status::timeout : std::cv_status::no_timeout;
+		}
+
+		template<concepts::basic_lockable TLock, typename TClock, typename TDuration, std::predicate TPredicate>
+		bool wait_until(TLock& lock, const std::chrono::time_point<TClock, TDuration>& deadline, TPredicate predicate)
+		{
+			while (!predicate())
+			{
+				if (wait_until(lock, deadline) == std::cv_status::timeout)
+				{
+					return predicate();
+				}
+			}
+			return true;
+		}
+
+		template<concepts::basic_lockable TLock, typename TRep, typename TPeriod>
+		std::cv_status wait_for(TLock& lock, const std::chrono::duration<TRep, TPeriod>& duration)
+		{
+			return wait_until(lock, std::chrono::steady_clock::now() + duration);
+		}
+
+		template<concepts::basic_lockable TLock, typename TRep, typename TPeriod, std::predicate TPredicate>
+		bool wait_for(TLock& lock, const std::chrono::duration<TRep, TPeriod>& duration, TPredicate predicate)
+		{
+			return wait_until(lock, std::chrono::steady_clock::now() + duration, std::move(predicate));
+		}
+
+	private:
+		// Runs under the bucket lock while the caller still holds its own lock, so a notifier
+		// that changes the waited-on state under that lock is guaranteed to see the flag.
+		auto enqueue_validator() noexcept
+		{
+			return [this]
+			{
+				m_has_waiters.store(1, std::memory_order_seq_cst);
+				return true;
+			};
+		}
+
+		std::atomic<std::uint8_t> m_has_waiters{ 0 };
+	};
+
+	// One-byte mutex: a locked bit and a parked bit.  Uncontended lock and unlock are a single
+	// compare-exchange; contended lockers spin briefly and then park on the mutex's address.
+	class byte_mutex
+	{
+	public:
+		using condition_variable_type = parking_condition;
+
+		byte_mutex() noexcept = default;
+		byte_mutex(const byte_mutex& other) = delete;
+		byte_mutex(byte_mutex&& other) noexcept = delete;
+		byte_mutex& operator=(const byte_mutex& other) = delete;
+		byte_mutex& operator=(byte_mutex&& other) noexcept = delete;
+		~byte_mutex() = default;
+
+		void lock()
+		{
+			std::uint8_t expected = 0;
+			if (!m_state.compare_exchange_weak(expected, locked_bit, std::memory_order_acquire, std::memory_order_relaxed))
+			{
+				lock_slow();
+			}
+		}
+
+		[[nodiscard]] bool try_lock() noexcept
+		{
+			std::uint8_t state = m_state.load(std::memory_order_relaxed);
+			while ((state & locked_bit) == 0)
+			{
+				if (m_state.compare_exchange_weak(state, state | locked_bit, std::memory_order_acquire, std::memory_order_relaxed))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void unlock()
+		{
+			std::uint8_t expected = locked_bit;
+			if (!m_state.compare_exchange_strong(expected, 0, std::memory_order_release, std::memory_order_relaxed))
+			{
+				unlock_slow();
+			}
+		}
+
+	private:
+		static constexpr std::uint8_t locked_bit = 0x01;
+		static constexpr std::uint8_t parked_bit = 0x02;
+		static constexpr unsigned spin_limit = 40;
+
+		void lock_slow()
+		{
+			unsigned spins = 0;
+			for (;;)
+			{
+				std::uint8_t state = m_state.load(std::memory_order_relaxed);
+				if ((state & locked_bit) == 0)
+				{
+					if (m_state.compare_exchange_weak(state, state | locked_bit, std::memory_order_acquire, std::memory_order_relaxed))
+					{
+						return;
+					}
+					continue;
+				}
+				if ((state & parked_bit) == 0)
+				{
+					if (spins < spin_limit)
+					{
+						++spins;
+						detail::cpu_relax();
+						continue;
+					}
+					if (!m_state.compare_exchange_weak(state, state | parked_bit, std::memory_order_relaxed, std::memory_order_relaxed))
+					{
+						continue;
+					}
+				}
+				detail::parking_lot::park(this,
+					[this] { return m_state.load(std::memory_order_relaxed) == (locked_bit | parked_bit); },
+					[] {});
+			}
+		}
+
+		void unlock_slow()
+		{
+			detail::parking_lot::unpark_one(this, [this](detail::parking_lot::unpark_result result)
+			{
+				m_state.store(result.may_have_more ? parked_bit : 0, std::memory_order_release);
+			});
+		}
+
+		std::atomic<std::uint8_t> m_state{ 0 };
+	};
+}
+#endif
@@ -0,0 +1,340 @@
+#ifndef CJM_SYNCHRO_RCU_HPP_
+#define CJM_SYNCHRO_RCU_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cjm::synchro
+{
+	template<typename TLocked>
+	class rcu_snapshot;
+
+	template<typename TLocked, concepts::mutex TMutex = std::mutex>
+	class rcu_vault;
+}
+
+namespace cjm::synchro::detail
+{
+	// Epoch-based reclamation shared by every rcu_vault.  Each reading thread owns one
+	// cache-line-sized record in which it publishes the global epoch it observed when it pinned;
+	// a version retired at epoch E may be freed once no record is pinned at an epoch below E.
+	class rcu_domain
+	{
+	public:
+		static constexpr std::uint64_t quiescent = 0;
+
+		struct alignas(cache_line_size) reader_record
+		{
+			std::atomic<std::uint64_t> epoch{ quiescent };
+			std::atomic<bool> in_use{ false };
+			std::uint32_t nesting{ 0 };
+			reader_record* next{ nullptr };
+		};
+
+		[[nodiscard]] static rcu_domain& global() noexcept
+		{
+			static rcu_domain* const domain = new rcu_domain{};
+			return *domain;
+		}
+
+		rcu_domain(const rcu_domain& other) = delete;
+		rcu_domain(rcu_domain&& other) noexcept = delete;
+		rcu_domain& operator=(const rcu_domain& other) = delete;
+		rcu_domain& operator=(rcu_domain&& other) noexcept = delete;
+		~rcu_domain() = default;
+
+		[[nodiscard]] reader_record* pin() noexcept
+		{
+			reader_record* record = local_record();
+			if (record->nesting++ == 0)
+			{
+				record->epoch.store(m_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+			}
+			return record;
+		}
+
+		static void unpin(reader_record* record) noexcept
+		{
+			assert(record != nullptr && record->nesting > 0);
+			if (--record->nesting == 0)
+			{
+				record->epoch.store(quiescent, std::memory_order_release);
+			}
+		}
+
+		[[nodiscard]] std::uint64_t advance() noexcept
+		{
+			return m_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+		}
+
+		[[nodiscard]] bool readers_past(std::uint64_t retire_epoch) const noexcept
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			for (const reader_record* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+			{
+				const std::uint64_t pinned = record->epoch.load(std::memory_order_acquire);
+				if (pinned != quiescent && pinned < retire_epoch)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		void wait_for_readers(std::uint64_t retire_epoch) const noexcept
+		{
+			for (unsigned spins = 0; !readers_past(retire_epoch); ++spins)
+			{
+				if (spins < 64)
+				{
+					cpu_relax();
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+	private:
+		struct record_lease
+		{
+			explicit record_lease(rcu_domain& domain) : m_record{ domain.acquire_record() } {}
+			record_lease(const record_lease& other) = delete;
+			record_lease& operator=(const record_lease& other) = delete;
+			~record_lease()
+			{
+				assert(m_record->nesting == 0);
+				m_record->in_use.store(false, std::memory_order_release);
+			}
+			reader_record* m_record;
+		};
+
+		rcu_domain() noexcept = default;
+
+		reader_record* local_record()
+		{
+			thread_local record_lease lease{ *this };
+			return lease.m_record;
+		}
+
+		reader_record* acquire_record()
+		{
+			for (reader_record* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+			{
+				bool expected = false;
+				if (!record->in_use.load(std::memory_order_relaxed) &&
+					record->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+				{
+					return record;
+				}
+			}
+			auto* record = new reader_record{};
+			record->in_use.store(true, std::memory_order_relaxed);
+			reader_record* head = m_records.load(std::memory_order_relaxed);
+			do
+			{
+				record->next = head;
+			} while (!m_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+			return record;
+		}
+
+		std::atomic<std::uint64_t> m_epoch{ 1 };
+		std::atomic<reader_record*> m_records{ nullptr };
+	};
+}
+
+namespace cjm::synchro
+{
+	// A pinned, reference-stable view of one published version.  It must be released on the
+	// thread that took it and must not outlive the vault it came from.
+	template<typename TLocked>
+	class rcu_snapshot
+	{
+		template<typename T, concepts::mutex TMutex>
+		friend class rcu_vault;
+	public:
+		using locked_t = std::remove_reference_t<TLocked>;
+		using const_locked_t = std::add_const_t<locked_t>;
+
+		rcu_snapshot() noexcept = default;
+		rcu_snapshot(const rcu_snapshot& other) = delete;
+		rcu_snapshot(rcu_snapshot&& other) noexcept
+			: m_record{ std::exchange(other.m_record, nullptr) }, m_datum{ std::exchange(other.m_datum, nullptr) } {}
+		rcu_snapshot& operator=(const rcu_snapshot& other) = delete;
+		rcu_snapshot& operator=(rcu_snapshot&& other) noexcept
+		{
+			if (this != &other)
+			{
+				release();
+				m_record = std::exchange(other.m_record, nullptr);
+				m_datum = std::exchange(other.m_datum, nullptr);
+			}
+			return *this;
+		}
+		~rcu_snapshot() { release(); }
+
+		[[nodiscard]] const_locked_t* get() const noexcept { return m_datum; }
+		[[nodiscard]] const_locked_t* operator->() const noexcept { assert(m_datum != nullptr); return m_datum; }
+		[[nodiscard]] const_locked_t& operator*() const noexcept { assert(m_datum != nullptr); return *m_datum; }
+		[[nodiscard]] explicit operator bool() const noexcept { return m_datum != nullptr; }
+
+		void release() noexcept
+		{
+			if (m_record != nullptr)
+			{
+				detail::rcu_domain::unpin(std::exchange(m_record, nullptr));
+				m_datum = nullptr;
+			}
+		}
+
+	private:
+		rcu_snapshot(detail::rcu_domain::reader_record* record, const_locked_t* datum) noexcept
+			: m_record{ record }, m_datum{ datum } {}
+
+		detail::rcu_domain::reader_record* m_record{ nullptr };
+		const_locked_t* m_datum{ nullptr };
+	};
+
+	// Read-copy-update vault: readers take an rcu_snapshot without touching the mutex; writers
+	// serialize on TMutex, copy the current version, mutate the copy and publish it with a single
+	// atomic store.  Superseded versions are freed once every reader that could see them is done.
+	template<typename TLocked, concepts::mutex TMutex>
+	class rcu_vault
+	{
+	public:
+		using locked_t = std::remove_reference_t<TLocked>;
+		using const_locked_t = std::add_const_t<locked_t>;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using snapshot_t = rcu_snapshot<TLocked>;
+
+		rcu_vault() requires (std::is_default_constructible_v<locked_t>)
+			: m_mutex{}, m_current{ new locked_t{} }, m_retired{} {}
+		template<typename...TArgs>
+			requires (sizeof...(TArgs) > 0 && std::constructible_from<locked_t, TArgs...>)
+		explicit rcu_vault(TArgs&&... args)
+			: m_mutex{}, m_current{ new locked_t{ std::forward<TArgs>(args)... } }, m_retired{} {}
+		rcu_vault(const rcu_vault& other) = delete;
+		rcu_vault(rcu_vault&& other) noexcept = delete;
+		rcu_vault& operator=(const rcu_vault& other) = delete;
+		rcu_vault& operator=(rcu_vault&& other) noexcept = delete;
+		~rcu_vault()
+		{
+			delete m_current.load(std::memory_order_acquire);
+			for (auto& [epoch, retired] : m_retired)
+			{
+				delete retired;
+			}
+		}
+
+		[[nodiscard]] snapshot_t read() const noexcept
+		{
+			detail::rcu_domain::reader_record* record = detail::rcu_domain::global().pin();
+			return snapshot_t{ record, m_current.load(std::memory_order_seq_cst) };
+		}
+
+		[[nodiscard]] auto copy_locked_datum() const -> locked_t
+			requires (std::copy_constructible<locked_t>)
+		{
+			const snapshot_t snapshot = read();
+			return *snapshot;
+		}
+
+		// The result is returned by value: the copy the updater saw is published and may be
+		// reclaimed as soon as a later update replaces it.
+		template<std::invocable<locked_t&> TUpdater>
+			requires (std::copy_constructible<locked_t> && !std::is_reference_v<std::invoke_result_t<TUpdater&, locked_t&>>)
+		auto update(TUpdater updater)
+		{
+			auto lck = lock_t{ m_mutex };
+			auto next = std::make_unique<locked_t>(*m_current.load(std::memory_order_relaxed));
+			if constexpr (std::is_void_v<std::invoke_result_t<TUpdater&, locked_t&>>)
+			{
+				std::invoke(updater, *next);
+				publish(std::move(next));
+			}
+			else
+			{
+				auto result = std::invoke(updater, *next);
+				publish(std::move(next));
+				return result;
+			}
+		}
+
+		void assign_locked_datum(const locked_t& new_datum)
+			requires (std::copy_constructible<locked_t>)
+		{
+			auto next = std::make_unique<locked_t>(new_datum);
+			auto lck = lock_t{ m_mutex };
+			publish(std::move(next));
+		}
+
+		void assign_locked_datum(locked_t&& new_datum)
+			requires (std::move_constructible<locked_t>)
+		{
+			auto next = std::make_unique<locked_t>(std::move(new_datum));
+			auto lck = lock_t{ m_mutex };
+			publish(std::move(next));
+		}
+
+		// Blocks the caller (never a reader) until every superseded version has been freed.
+		void synchronize()
+		{
+			auto lck = lock_t{ m_mutex };
+			if (!m_retired.empty())
+			{
+				detail::rcu_domain::global().wait_for_readers(m_retired.back().first);
+				reclaim_impl();
+			}
+		}
+
+		std::size_t reclaim()
+		{
+			auto lck = lock_t{ m_mutex };
+			return reclaim_impl();
+		}
+
+		[[nodiscard]] std::size_t retired_count() const
+		{
+			auto lck = lock_t{ m_mutex };
+			return m_retired.size();
+		}
+
+	private:
+		void publish(std::unique_ptr<locked_t> next)
+		{
+			m_retired.reserve(m_retired.size() + 1);
+			const_locked_t* previous = m_current.exchange(next.release(), std::memory_order_seq_cst);
+			m_retired.emplace_back(detail::rcu_domain::global().advance(), previous);
+			reclaim_impl();
+		}
+
+		std::size_t reclaim_impl() noexcept
+		{
+			const detail::rcu_domain& domain = detail::rcu_domain::global();
+			std::size_t freed = 0;
+			while (freed < m_retired.size() && domain.readers_past(m_retired[freed].first))
+			{
+				delete m_retired[freed].second;
+				++freed;
+			}
+			m_retired.erase(m_retired.begin(), m_retired.begin() + static_cast<std::ptrdiff_t>(freed));
+			return freed;
+		}
+
+		mutable mutex_t m_mutex;
+		std::atomic<const_locked_t*> m_current;
+		std::vector<std::pair<std::uint64_t, const_locked_t*>> m_retired;
+	};
+}
+#endif
@@ -0,0 +1,177 @@
+#ifndef CJM_SYNCHRO_SHARDED_VAULT_HPP_
+#define CJM_SYNCHRO_SHARDED_VAULT_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace cjm::synchro
+{
+	template<typename TMap, std::size_t N = 16, concepts::mutex TMutex = std::mutex>
+	class sharded_vault;
+}
+
+namespace cjm::synchro::detail
+{
+	template<typename TMap>
+	struct shard_hasher
+	{
+		using type = std::hash<typename TMap::key_type>;
+	};
+
+	template<typename TMap>
+		requires requires { typename TMap::hasher; }
+	struct shard_hasher<TMap>
+	{
+		using type = typename TMap::hasher;
+	};
+
+	// The container hashes the same key again for its own buckets; mixing keeps the shard index
+	// from using the same low bits and leaving each shard's buckets half empty.
+	[[nodiscard]] constexpr std::size_t mix_shard_hash(std::uint64_t hash) noexcept
+	{
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdULL;
+		hash ^= hash >> 33;
+		return static_cast<std::size_t>(hash);
+	}
+}
+
+namespace cjm::synchro
+{
+	// N independently locked copies of a keyed container.  with(key, fn) locks only the shard the
+	// key hashes to, so operations on different shards proceed in parallel.  Whole-container
+	// operations (for_each_shard, size, clear) lock every shard in index order and hold them all,
+	// so they observe one consistent state and cannot deadlock against each other.  Calling with()
+	// from inside a for_each_shard callback self-deadlocks.
+	template<typename TMap, std::size_t N, concepts::mutex TMutex>
+	class sharded_vault
+	{
+		static_assert(N > 0);
+	public:
+		using map_t = TMap;
+		using key_t = typename TMap::key_type;
+		using hasher_t = typename detail::shard_hasher<TMap>::type;
+		using vault_t = synchro_vault<TMap, TMutex>;
+		using locked_ptr_t = typename vault_t::locked_ptr_t;
+		using shared_locked_ptr_t = typename vault_t::shared_locked_ptr_t;
+		static constexpr std::size_t shard_count = N;
+		static constexpr bool supports_shared = concepts::shared_mutex<TMutex>;
+
+		sharded_vault() requires (std::is_default_constructible_v<TMap>) = default;
+		sharded_vault(const sharded_vault& other) = delete;
+		sharded_vault(sharded_vault&& other) noexcept = delete;
+		sharded_vault& operator=(const sharded_vault& other) = delete;
+		sharded_vault& operator=(sharded_vault&& other) noexcept = delete;
+		~sharded_vault() = default;
+
+		[[nodiscard]] std::size_t shard_index(const key_t& key) const
+		{
+			return detail::mix_shard_hash(static_cast<std::uint64_t>(std::invoke(hasher_t{}, key))) % N;
+		}
+
+		// The lock is released before these return, so results come back by value.
+		template<std::invocable<TMap&> TFunction>
+			requires (!std::is_reference_v<std::invoke_result_t<TFunction&, TMap&>>)
+		auto with(const key_t& key, TFunction fn)
+		{
+			auto ptr = m_shards[shard_index(key)].vault.lock();
+			return std::invoke(fn, *ptr);
+		}
+
+		template<std::invocable<const TMap&> TFunction>
+			requires (supports_shared && !std::is_reference_v<std::invoke_result_t<TFunction&, const TMap&>>)
+		auto with_shared(const key_t& key, TFunction fn) const
+		{
+			auto ptr = m_shards[shard_index(key)].vault.lock_shared();
+			return std::invoke(fn, *ptr);
+		}
+
+		[[nodiscard]] locked_ptr_t lock_shard(std::size_t index)
+		{
+			return m_shards[index].vault.lock();
+		}
+
+		[[nodiscard]] shared_locked_ptr_t lock_shard_shared(std::size_t index) const requires (supports_shared)
+		{
+			return m_shards[index].vault.lock_shared();
+		}
+
+		// fn(map, shard_index) for every shard, with all shards locked for the whole pass.
+		template<std::invocable<TMap&, std::size_t> TFunction>
+		void for_each_shard(TFunction fn)
+		{
+			auto ptrs = lock_all_shards();
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				std::invoke(fn, *ptrs[i], i);
+			}
+		}
+
+		template<std::invocable<const TMap&, std::size_t> TFunction>
+		void for_each_shard(TFunction fn) const
+		{
+			auto ptrs = lock_all_shards();
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				std::invoke(fn, std::as_const(*ptrs[i]), i);
+			}
+		}
+
+		[[nodiscard]] std::size_t size() const
+		{
+			std::size_t total = 0;
+			for_each_shard([&total](const TMap& map, std::size_t) { total += map.size(); });
+			return total;
+		}
+
+		void clear()
+		{
+			for_each_shard([](TMap& map, std::size_t) { map.clear(); });
+		}
+
+	private:
+		// Ascending index order is the global lock order for every multi-shard operation; braced
+		// initializers are evaluated left to right, which is what fixes it here.
+		template<std::size_t... Indices>
+		[[nodiscard]] auto lock_all_shards_for_read(std::index_sequence<Indices...>) const
+		{
+			if constexpr (supports_shared)
+				return std::array<shared_locked_ptr_t, N>{ m_shards[Indices].vault.lock_shared()... };
+			else
+				return std::array<locked_ptr_t, N>{ m_shards[Indices].vault.lock()... };
+		}
+
+		[[nodiscard]] std::array<locked_ptr_t, N> lock_all_shards()
+		{
+			return lock_all_shards_exclusive(std::make_index_sequence<N>{});
+		}
+
+		[[nodiscard]] auto lock_all_shards() const
+		{
+			return lock_all_shards_for_read(std::make_index_sequence<N>{});
+		}
+
+		template<std::size_t... Indices>
+		[[nodiscard]] std::array<locked_ptr_t, N> lock_all_shards_exclusive(std::index_sequence<Indices...>)
+		{
+			return std::array<locked_ptr_t, N>{ m_shards[Indices].vault.lock()... };
+		}
+
+		struct alignas(detail::cache_line_size) shard_t
+		{
+			vault_t vault;
+		};
+
+		// Mutable so const whole-container reads can still take exclusive locks when TMutex has no
+		// shared mode, as ctrl_block does for its own mutex.
+		mutable std::array<shard_t, N> m_shards;
+	};
+}
+#endif
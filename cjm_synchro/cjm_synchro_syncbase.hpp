@@ -4,8 +4,30 @@
 #include <type_traits>
 #include <concepts>
 #include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <iomanip>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <thread>
 #include <utility>
+#include <vector>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
 #ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
@@ -13,120 +35,4007 @@
 #include <boost/thread/lock_types.hpp>
 #endif
 
-namespace cjm::synchro::detail
-{
-	static constexpr bool using_boost =
-#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
-		true;
-#else
-		false;
-#endif
-	enum class lock_release_notify
-	{
-		none = 0,
-		one,
-		all
+#if defined(_MSC_VER) && !defined(__clang__)
+#define CJM_SYNCHRO_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define CJM_SYNCHRO_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+// Line size used to keep independently written state apart.  Define it to pin the value;
+// otherwise std::hardware_destructive_interference_size where the library has it, else 64.
+// GCC derives its value from -mtune, so pin the macro if padded objects are shared between
+// translation units built with different tuning.
+#ifndef CJM_SYNCHRO_CACHE_LINE_SIZE
+#ifdef __cpp_lib_hardware_interference_size
+#define CJM_SYNCHRO_CACHE_LINE_SIZE std::hardware_destructive_interference_size
+#else
+#define CJM_SYNCHRO_CACHE_LINE_SIZE 64
+#endif
+#endif
+
+namespace cjm::synchro
+{
+	enum class release_notify_policy
+	{
+		none = 0,
+		one,
+		all,
+		runtime
+	};
+
+	enum class wait_policy
+	{
+		condition_variable = 0,
+		futex,
+		none
+	};
+
+	enum class stats_policy
+	{
+		none = 0,
+		enabled,
+		traced
+	};
+
+	enum class layout_policy
+	{
+		packed = 0,
+		isolated_mutex,
+		colocated
+	};
+
+	// Customization point for compile-time vault behaviour.  Specialize it for a
+	// (TLocked, TMutex, Level) combination and declare only the members you want to change;
+	// anything left out keeps its default.
+	//   release_notify: what a locked_ptr does to the condition variable when it releases.
+	//                   Anything but runtime removes set_release_notification and its storage.
+	//   wait:           what backs wait/notify.  condition_variable (the default) uses the mutex's
+	//                   condition variable; futex uses a 32-bit generation counter and
+	//                   std::atomic::wait; none removes wait/notify from the vault and its
+	//                   pointers, stores nothing, and implies release_notify = none.
+	//   stats:          enabled counts acquisitions (contended ones are those a try_lock could not
+	//                   take), wait and exclusive hold times and condition wakeups, and lists the
+	//                   vault in stats_registry.  none (the default) stores and executes nothing.
+	//                   traced does everything enabled does and also records every contended
+	//                   wait and the same sample of exclusive holds in lock_trace, labelled with
+	//                   the std::source_location of the lock()/lock_shared()/lock_upgrade()/
+	//                   try_lock*()/scoped_unlock() call.
+	//   layout:         where the ctrl_block puts its members relative to cache lines.  packed
+	//                   (the default) adds no padding.  isolated_mutex gives the mutex, the
+	//                   datum and the condition variable a line each, so waiters spinning on
+	//                   the lock word are not disturbed by the holder's writes to the datum.
+	//                   colocated starts the mutex on a line and packs the rest behind it, so
+	//                   one miss brings in the lock word and the head of the datum when the
+	//                   condition in between is small (wait_policy::futex, four bytes) or
+	//                   absent (wait_policy::none).  Both align the whole vault, so
+	//                   neighbouring objects never share its lines.
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	struct vault_traits {};
+
+	// Counters of one vault, summed over its per-thread shards.  Histogram bucket b counts
+	// durations of d nanoseconds with std::bit_width(d) == b, i.e. 2^(b-1) <= d < 2^b; the
+	// last bucket also takes everything longer.  wait_ns has an entry for every acquisition;
+	// hold_ns only for a random sample of about one hold in
+	// detail::hold_timer<true>::sample_period.  Shards are read one at a time without
+	// stopping the vault, so the fields are mutually consistent only when it is quiet.
+	struct vault_stats_snapshot
+	{
+		static constexpr std::size_t bucket_count = 32;
+		using histogram_t = std::array<std::uint64_t, bucket_count>;
+
+		std::string name;
+		const void* address{ nullptr };
+		std::uint64_t acquisitions{ 0 };
+		std::uint64_t contended_acquisitions{ 0 };
+		std::uint64_t wakeups{ 0 };
+		std::uint64_t spurious_wakeups{ 0 };
+		histogram_t wait_ns{};
+		histogram_t hold_ns{};
+
+		// Upper bound of the bucket holding the q-th quantile (0 < q <= 1), or 0 if empty.
+		[[nodiscard]] static std::uint64_t percentile_ns(const histogram_t& histogram, double q) noexcept
+		{
+			std::uint64_t total = 0;
+			for (const std::uint64_t count : histogram)
+			{
+				total += count;
+			}
+			if (total == 0)
+			{
+				return 0;
+			}
+			const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(total) + 0.5);
+			std::uint64_t seen = 0;
+			for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+			{
+				seen += histogram[bucket];
+				if (seen >= rank && seen != 0)
+				{
+					return (std::uint64_t{ 1 } << bucket) - 1;
+				}
+			}
+			return (std::uint64_t{ 1 } << (bucket_count - 1)) - 1;
+		}
+	};
+
+	class stats_registry;
+}
+
+namespace cjm::synchro::detail
+{
+	static constexpr bool using_boost =
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+		true;
+#else
+		false;
+#endif
+	// Timed vault acquisition accepts std or boost chrono arguments and converts them to the
+	// library the mutex's timed functions take (time_library_v).  Deadlines on the other
+	// library's clock are re-anchored on the target library's steady_clock.
+	template<concepts::time_type Time, concepts::duration TDuration>
+	auto to_mutex_duration(const TDuration& d)
+	{
+		static_assert(Time != concepts::time_type::not_timed_or_unknown);
+		if constexpr (Time == concepts::time_type::std && concepts::detail::std_duration<TDuration>)
+			return d;
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+		else if constexpr (Time == concepts::time_type::boost && concepts::detail::boost_duration<TDuration>)
+			return d;
+		else if constexpr (Time == concepts::time_type::std)
+			return std::chrono::nanoseconds{ boost::chrono::duration_cast<boost::chrono::nanoseconds>(d).count() };
+		else
+			return boost::chrono::nanoseconds{ std::chrono::duration_cast<std::chrono::nanoseconds>(d).count() };
+#endif
+	}
+
+	template<concepts::time_type Time, concepts::time_point TTimePoint>
+	auto to_mutex_deadline(const TTimePoint& tp)
+	{
+		static_assert(Time != concepts::time_type::not_timed_or_unknown);
+		if constexpr (Time == concepts::time_type::std && concepts::detail::std_time_point<TTimePoint>)
+			return tp;
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+		else if constexpr (Time == concepts::time_type::boost && concepts::detail::boost_time_point<TTimePoint>)
+			return tp;
+		else if constexpr (Time == concepts::time_type::std)
+			return std::chrono::steady_clock::now() + to_mutex_duration<Time>(tp - TTimePoint::clock::now());
+		else
+			return boost::chrono::steady_clock::now() + to_mutex_duration<Time>(tp - TTimePoint::clock::now());
+#endif
+	}
+
+	enum class lock_release_notify
+	{
+		none = 0,
+		one,
+		all
+	};
+
+	template<typename TTraits>
+	concept declares_release_notify = requires
+	{
+		{ TTraits::release_notify } -> std::convertible_to<release_notify_policy>;
+	};
+
+	template<typename TTraits>
+	concept declares_wait = requires
+	{
+		{ TTraits::wait } -> std::convertible_to<wait_policy>;
+	};
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	constexpr wait_policy wait_policy_for() noexcept
+	{
+		if constexpr (declares_wait<vault_traits<TLocked, TMutex, Level>>)
+			return vault_traits<TLocked, TMutex, Level>::wait;
+		else
+			return wait_policy::condition_variable;
+	}
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	inline constexpr bool waitable_v = wait_policy_for<TLocked, TMutex, Level>() != wait_policy::none;
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	constexpr release_notify_policy release_notify_policy_for() noexcept
+	{
+		if constexpr (!waitable_v<TLocked, TMutex, Level>)
+			return release_notify_policy::none;
+		else if constexpr (declares_release_notify<vault_traits<TLocked, TMutex, Level>>)
+			return vault_traits<TLocked, TMutex, Level>::release_notify;
+		else
+			return release_notify_policy::runtime;
+	}
+
+	// What a locked pointer does to the condition variable on release.  The fixed policies are
+	// empty and answer with a constant, so the release path folds away; only runtime stores a
+	// setting.  A locked pointer is never shared between threads, so no atomic is needed.
+	template<release_notify_policy Policy>
+	class release_notifier
+	{
+	public:
+		static constexpr release_notify_policy policy = Policy;
+
+		[[nodiscard]] constexpr lock_release_notify setting() const noexcept
+		{
+			if constexpr (Policy == release_notify_policy::one)
+				return lock_release_notify::one;
+			else if constexpr (Policy == release_notify_policy::all)
+				return lock_release_notify::all;
+			else
+				return lock_release_notify::none;
+		}
+
+		[[nodiscard]] constexpr lock_release_notify take() noexcept
+		{
+			return setting();
+		}
+	};
+
+	template<>
+	class release_notifier<release_notify_policy::runtime>
+	{
+	public:
+		static constexpr release_notify_policy policy = release_notify_policy::runtime;
+
+		release_notifier() noexcept = default;
+		release_notifier(const release_notifier& other) = delete;
+		release_notifier(release_notifier&& other) noexcept
+			: m_setting{ other.take() } {}
+		release_notifier& operator=(const release_notifier& other) = delete;
+		release_notifier& operator=(release_notifier&& other) noexcept
+		{
+			m_setting = other.take();
+			return *this;
+		}
+		~release_notifier() = default;
+
+		[[nodiscard]] lock_release_notify setting() const noexcept
+		{
+			return m_setting;
+		}
+
+		[[nodiscard]] lock_release_notify take() noexcept
+		{
+			return std::exchange(m_setting, lock_release_notify::none);
+		}
+
+		void set(lock_release_notify lrn) noexcept
+		{
+			m_setting = lrn;
+		}
+
+	private:
+		lock_release_notify m_setting{ lock_release_notify::none };
+	};
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	using release_notifier_for_t = release_notifier<release_notify_policy_for<TLocked, TMutex, Level>()>;
+
+	template<typename TTraits>
+	concept declares_stats = requires
+	{
+		{ TTraits::stats } -> std::convertible_to<stats_policy>;
+	};
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	constexpr stats_policy stats_policy_for() noexcept
+	{
+		if constexpr (declares_stats<vault_traits<TLocked, TMutex, Level>>)
+			return vault_traits<TLocked, TMutex, Level>::stats;
+		else
+			return stats_policy::none;
+	}
+
+	template<typename TTraits>
+	concept declares_layout = requires
+	{
+		{ TTraits::layout } -> std::convertible_to<layout_policy>;
+	};
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	constexpr layout_policy layout_policy_for() noexcept
+	{
+		if constexpr (declares_layout<vault_traits<TLocked, TMutex, Level>>)
+			return vault_traits<TLocked, TMutex, Level>::layout;
+		else
+			return layout_policy::packed;
+	}
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	inline constexpr bool stats_enabled_v = stats_policy_for<TLocked, TMutex, Level>() != stats_policy::none;
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	inline constexpr bool trace_enabled_v = stats_policy_for<TLocked, TMutex, Level>() == stats_policy::traced;
+
+	// Stand-in for std::source_location when a vault is not traced.  Vault and pointer members
+	// take a call site defaulted to call_site_t::current(), which for this type is free.
+	struct no_call_site
+	{
+		[[nodiscard]] static constexpr no_call_site current() noexcept { return {}; }
+	};
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 12
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+	inline constexpr std::size_t cache_line_size = CJM_SYNCHRO_CACHE_LINE_SIZE;
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 12
+#pragma GCC diagnostic pop
+#endif
+
+	inline void cpu_relax() noexcept
+	{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		_mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+		__asm__ __volatile__("yield");
+#endif
+	}
+
+	// Clock of the stats and trace timestamps.  On x86 with an invariant time-stamp counter it
+	// reads the counter, a fraction of the cost of steady_clock::now(), and scales it with a
+	// factor measured against steady_clock on first use (a few hundred microseconds, once per
+	// process); elsewhere it is steady_clock.  Only differences between its readings mean
+	// anything.  A thread that migrates between cores mid-interval sees whatever skew the
+	// counters have, which the firmware keeps far below a histogram bucket.
+	struct stats_clock
+	{
+		using rep = std::int64_t;
+		using period = std::nano;
+		using duration = std::chrono::nanoseconds;
+		using time_point = std::chrono::time_point<stats_clock>;
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]] static time_point now() noexcept
+		{
+			const double ns_per_tick = scale();
+			if (ns_per_tick > 0.0)
+			{
+				return time_point{ duration{ static_cast<rep>(static_cast<double>(read_tsc()) * ns_per_tick) } };
+			}
+			return time_point{ std::chrono::duration_cast<duration>(std::chrono::steady_clock::now().time_since_epoch()) };
+		}
+
+	private:
+		[[nodiscard]] static std::uint64_t read_tsc() noexcept
+		{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+			return __builtin_ia32_rdtsc();
+#else
+			return 0;
+#endif
+		}
+
+		// CPUID leaf 0x80000007, EDX bit 8: the counter ticks at a constant rate in every
+		// P-, C- and T-state.
+		[[nodiscard]] static bool has_invariant_tsc() noexcept
+		{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			int regs[4]{};
+			__cpuid(regs, static_cast<int>(0x80000000u));
+			if (static_cast<unsigned>(regs[0]) < 0x80000007u)
+				return false;
+			__cpuid(regs, static_cast<int>(0x80000007u));
+			return (regs[3] & (1 << 8)) != 0;
+#elif defined(__x86_64__) || defined(__i386__)
+			unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+			return __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx) != 0 && (edx & (1u << 8)) != 0;
+#else
+			return false;
+#endif
+		}
+
+		// Nanoseconds per counter tick, or 0 to use steady_clock.
+		[[nodiscard]] static double scale() noexcept
+		{
+			static const double ns_per_tick = calibrate();
+			return ns_per_tick;
+		}
+
+		[[nodiscard]] static double calibrate() noexcept
+		{
+			if (!has_invariant_tsc())
+				return 0.0;
+			using steady_t = std::chrono::steady_clock;
+			// Each steady_clock reading is bracketed by two counter reads and paired with their
+			// midpoint, so the error is bounded by the bracket rather than by the clock's cost.
+			const auto sample = [](steady_t::time_point& at) noexcept
+			{
+				const std::uint64_t before = read_tsc();
+				at = steady_t::now();
+				const std::uint64_t after = read_tsc();
+				return before + (after - before) / 2;
+			};
+			steady_t::time_point start, stop;
+			const std::uint64_t first = sample(start);
+			std::uint64_t last = first;
+			do
+			{
+				last = sample(stop);
+			} while (stop - start < std::chrono::microseconds{ 250 });
+			const auto elapsed = std::chrono::duration<double, std::nano>(stop - start).count();
+			return last > first ? elapsed / static_cast<double>(last - first) : 0.0;
+		}
+	};
+
+	// Global table of wait queues keyed by address.  Synchronization objects built on it keep
+	// no queue of their own: a thread that must block parks on the object's address and the
+	// releasing thread unparks it.  Validation and unpark callbacks run under the bucket lock, so
+	// an object can update its own state word atomically with respect to the queue.
+	class parking_lot
+	{
+	public:
+		enum class park_result
+		{
+			unparked,
+			invalid,
+			timed_out,
+		};
+
+		struct unpark_result
+		{
+			bool did_unpark;
+			bool may_have_more;
+		};
+
+		parking_lot() = delete;
+
+		template<std::predicate TValidate, std::invocable TBeforeSleep>
+		static park_result park(const void* address, TValidate validate, TBeforeSleep before_sleep)
+		{
+			return park_impl(address, validate, before_sleep, std::optional<std::chrono::steady_clock::time_point>{});
+		}
+
+		template<std::predicate TValidate, std::invocable TBeforeSleep, typename TClock, typename TDuration>
+		static park_result park_until(const void* address, TValidate validate, TBeforeSleep before_sleep,
+			const std::chrono::time_point<TClock, TDuration>& deadline)
+		{
+			return park_impl(address, validate, before_sleep, std::optional<std::chrono::time_point<TClock, TDuration>>{ deadline });
+		}
+
+		template<std::invocable<unpark_result> TCallback>
+		static unpark_result unpark_one(const void* address, TCallback callback)
+		{
+			waiter* unparked = nullptr;
+			unpark_result result{ false, false };
+			{
+				bucket& bkt = bucket_for(address);
+				auto lck = std::unique_lock<std::mutex>{ bkt.mutex };
+				unparked = bkt.remove_first(address);
+				result.did_unpark = unparked != nullptr;
+				result.may_have_more = bkt.contains(address);
+				std::invoke(callback, result);
+			}
+			if (unparked != nullptr)
+			{
+				unparked->signal();
+			}
+			return result;
+		}
+
+		static std::size_t unpark_all(const void* address)
+		{
+			waiter* head = nullptr;
+			waiter* tail = nullptr;
+			std::size_t count = 0;
+			{
+				bucket& bkt = bucket_for(address);
+				auto lck = std::unique_lock<std::mutex>{ bkt.mutex };
+				while (waiter* unparked = bkt.remove_first(address))
+				{
+					(tail == nullptr ? head : tail->next) = unparked;
+					tail = unparked;
+					++count;
+				}
+			}
+			while (head != nullptr)
+			{
+				waiter* next = head->next;
+				head->signal();
+				head = next;
+			}
+			return count;
+		}
+
+	private:
+		struct waiter
+		{
+			const void* address{ nullptr };
+			waiter* next{ nullptr };
+			std::mutex mutex;
+			std::condition_variable cv;
+			bool signaled{ false };
+
+			// The parked thread cannot return before it observes signaled, so nothing touches
+			// this waiter after the lock below is released.
+			void signal()
+			{
+				auto lck = std::unique_lock<std::mutex>{ mutex };
+				signaled = true;
+				cv.notify_one();
+			}
+		};
+
+		struct alignas(cache_line_size) bucket
+		{
+			std::mutex mutex;
+			waiter* head{ nullptr };
+			waiter* tail{ nullptr };
+
+			void enqueue(waiter* w) noexcept
+			{
+				w->next = nullptr;
+				(tail == nullptr ? head : tail->next) = w;
+				tail = w;
+			}
+
+			waiter* remove_first(const void* address) noexcept
+			{
+				waiter* previous = nullptr;
+				for (waiter* current = head; current != nullptr; previous = current, current = current->next)
+				{
+					if (current->address == address)
+					{
+						unlink(previous, current);
+						return current;
+					}
+				}
+				return nullptr;
+			}
+
+			bool remove(const waiter* w) noexcept
+			{
+				waiter* previous = nullptr;
+				for (waiter* current = head; current != nullptr; previous = current, current = current->next)
+				{
+					if (current == w)
+					{
+						unlink(previous, current);
+						return true;
+					}
+				}
+				return false;
+			}
+
+			[[nodiscard]] bool contains(const void* address) const noexcept
+			{
+				for (const waiter* current = head; current != nullptr; current = current->next)
+				{
+					if (current->address == address)
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+
+			void unlink(waiter* previous, waiter* current) noexcept
+			{
+				(previous == nullptr ? head : previous->next) = current->next;
+				if (tail == current)
+				{
+					tail = previous;
+				}
+				current->next = nullptr;
+			}
+		};
+
+		static constexpr std::size_t bucket_count = 256;
+
+		static bucket& bucket_for(const void* address) noexcept
+		{
+			static std::array<bucket, bucket_count> buckets{};
+			auto key = reinterpret_cast<std::uintptr_t>(address);
+			key ^= key >> 17;
+			key *= static_cast<std::uintptr_t>(0x9E3779B97F4A7C15ull);
+			return buckets[(key >> 8) & (bucket_count - 1)];
+		}
+
+		static waiter& local_waiter() noexcept
+		{
+			thread_local waiter w{};
+			return w;
+		}
+
+		template<typename TValidate, typename TBeforeSleep, typename TTimePoint>
+		static park_result park_impl(const void* address, TValidate& validate, TBeforeSleep& before_sleep,
+			const std::optional<TTimePoint>& deadline)
+		{
+			waiter& self = local_waiter();
+			bucket& bkt = bucket_for(address);
+			{
+				auto lck = std::unique_lock<std::mutex>{ bkt.mutex };
+				if (!std::invoke(validate))
+				{
+					return park_result::invalid;
+				}
+				self.address = address;
+				self.signaled = false;
+				bkt.enqueue(&self);
+			}
+			std::invoke(before_sleep);
+			{
+				auto lck = std::unique_lock<std::mutex>{ self.mutex };
+				if (!deadline.has_value())
+				{
+					self.cv.wait(lck, [&self] { return self.signaled; });
+					return park_result::unparked;
+				}
+				if (self.cv.wait_until(lck, *deadline, [&self] { return self.signaled; }))
+				{
+					return park_result::unparked;
+				}
+			}
+			{
+				auto lck = std::unique_lock<std::mutex>{ bkt.mutex };
+				if (bkt.remove(&self))
+				{
+					return park_result::timed_out;
+				}
+			}
+			// An unparker dequeued us between the timeout and the bucket lock; wait for its signal.
+			auto lck = std::unique_lock<std::mutex>{ self.mutex };
+			self.cv.wait(lck, [&self] { return self.signaled; });
+			return park_result::unparked;
+		}
+	};
+
+	// Reader presence spread over padded counters sharded by thread, so arriving readers on
+	// different cores rarely share a line.  A writer only needs to know when the sum is zero.
+	// Shards are only a placement hint: a reader may depart on a different thread (a moved
+	// shared_locked_ptr, a coroutine resumed elsewhere) from the one it arrived on, leaving one
+	// counter at +1 and another at -1, and the sum still comes out right.  Summing one shard
+	// at a time cannot report empty early: every arrival that counts happened before the
+	// drainer began, so a departure it sees can only cancel an arrival it also sees.
+	class sharded_read_indicator
+	{
+	public:
+		static constexpr std::size_t shard_count = 64;
+
+		void arrive(std::size_t shard) noexcept
+		{
+			m_counters[shard].count.fetch_add(1, std::memory_order_seq_cst);
+		}
+
+		// Sequentially consistent with the drainer's flag: either the drainer's next sum sees
+		// this departure or this departure sees the flag and wakes it.
+		void depart(std::size_t shard) noexcept
+		{
+			m_counters[shard].count.fetch_sub(1, std::memory_order_seq_cst);
+			if (m_drainer.flag.load(std::memory_order_seq_cst) != 0)
+			{
+				m_drainer.flag.store(0, std::memory_order_relaxed);
+				parking_lot::unpark_all(&m_drainer.flag);
+			}
+		}
+
+		[[nodiscard]] bool is_empty() const noexcept
+		{
+			std::int64_t sum = 0;
+			for (const auto& counter : m_counters)
+			{
+				sum += counter.count.load(std::memory_order_seq_cst);
+			}
+			return sum == 0;
+		}
+
+		// Spins briefly, then parks until a departure empties the indicator.
+		void wait_until_empty() const
+		{
+			drain(std::optional<std::chrono::steady_clock::time_point>{});
+		}
+
+		template<typename TClock, typename TDuration>
+		[[nodiscard]] bool wait_until_empty(const std::chrono::time_point<TClock, TDuration>& deadline) const
+		{
+			return drain(std::optional<std::chrono::time_point<TClock, TDuration>>{ deadline });
+		}
+
+		[[nodiscard]] static std::size_t local_shard() noexcept
+		{
+			thread_local const std::size_t shard = std::hash<std::thread::id>{}(std::this_thread::get_id()) % shard_count;
+			return shard;
+		}
+
+	private:
+		static constexpr unsigned spin_limit = 64;
+
+		template<typename TTimePoint>
+		bool drain(const std::optional<TTimePoint>& deadline) const
+		{
+			// Runs under the bucket lock, so a departure that misses the flag is one the sum sees.
+			const auto validate = [this]
+			{
+				m_drainer.flag.store(1, std::memory_order_seq_cst);
+				return !is_empty();
+			};
+			for (unsigned spins = 0; !is_empty(); ++spins)
+			{
+				if (spins < spin_limit)
+				{
+					cpu_relax();
+				}
+				else if (!deadline.has_value())
+				{
+					parking_lot::park(&m_drainer.flag, validate, [] {});
+				}
+				else if (parking_lot::park_until(&m_drainer.flag, validate, [] {}, *deadline) == parking_lot::park_result::timed_out)
+				{
+					return is_empty();
+				}
+			}
+			return true;
+		}
+
+		struct alignas(cache_line_size) counter_t
+		{
+			std::atomic<std::int64_t> count{ 0 };
+		};
+
+		// Read by every departure, written only by a drainer about to park.
+		struct alignas(cache_line_size) drainer_t
+		{
+			mutable std::atomic<std::uint32_t> flag{ 0 };
+		};
+
+		std::array<counter_t, shard_count> m_counters{};
+		drainer_t m_drainer{};
+	};
+
+	// Small index of the calling thread, unique among the threads alive at the same time, for
+	// tables that give each thread a slot of its own.  A thread hands its index back when it
+	// exits; a thread that finds all capacity indices taken gets capacity itself, meaning "no
+	// slot of your own", as does one still running code after its index was handed back.
+	class thread_index
+	{
+	public:
+		static constexpr std::size_t capacity = 256;
+
+		[[nodiscard]] static std::size_t current() noexcept
+		{
+			thread_local std::size_t index = unassigned;
+			if (index == unassigned) [[unlikely]]
+			{
+				claim(index);
+			}
+			return index;
+		}
+
+	private:
+		static constexpr std::size_t unassigned = ~std::size_t{ 0 };
+		static constexpr std::size_t word_bits = 64;
+		using words_t = std::array<std::atomic<std::uint64_t>, capacity / word_bits>;
+
+		struct releaser
+		{
+			std::size_t* index;
+			explicit releaser(std::size_t* owner) noexcept : index{ owner } {}
+			releaser(const releaser& other) = delete;
+			releaser(releaser&& other) noexcept = delete;
+			releaser& operator=(const releaser& other) = delete;
+			releaser& operator=(releaser&& other) noexcept = delete;
+			~releaser()
+			{
+				if (*index < capacity)
+				{
+					in_use()[*index / word_bits].fetch_and(~(std::uint64_t{ 1 } << (*index % word_bits)), std::memory_order_release);
+				}
+				*index = capacity;
+			}
+		};
+
+		[[nodiscard]] static words_t& in_use() noexcept
+		{
+			static constinit words_t words{};
+			return words;
+		}
+
+		// The acquire pairs with the release of the thread that last held the index, so
+		// whatever that thread wrote into its slots happens before the new owner's writes.
+		static void claim(std::size_t& index) noexcept
+		{
+			index = capacity;
+			for (std::size_t word = 0; word < in_use().size() && index == capacity; ++word)
+			{
+				std::uint64_t bits = in_use()[word].load(std::memory_order_relaxed);
+				while (bits != ~std::uint64_t{ 0 })
+				{
+					const auto bit = static_cast<std::size_t>(std::countr_one(bits));
+					bits = in_use()[word].fetch_or(std::uint64_t{ 1 } << bit, std::memory_order_acquire);
+					if ((bits & (std::uint64_t{ 1 } << bit)) == 0)
+					{
+						index = word * word_bits + bit;
+						break;
+					}
+				}
+			}
+			thread_local const releaser release{ &index };
+		}
+	};
+
+	template<typename TLock>
+	constexpr auto defer_lock_for() noexcept
+	{
+		if constexpr (std::is_constructible_v<TLock, typename TLock::mutex_type&, std::defer_lock_t>)
+			return std::defer_lock;
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+		else
+			return boost::defer_lock;
+#endif
+	}
+
+	// Condition waits release the mutex; the hold stops for their duration.
+	template<typename TTimer, typename TStats>
+	class hold_pause
+	{
+	public:
+		hold_pause(TTimer& timer, TStats& stats) noexcept : m_timer{ &timer }
+		{
+			timer.stop(stats);
+		}
+		hold_pause(const hold_pause& other) = delete;
+		hold_pause(hold_pause&& other) noexcept = delete;
+		hold_pause& operator=(const hold_pause& other) = delete;
+		hold_pause& operator=(hold_pause&& other) noexcept = delete;
+		~hold_pause() { m_timer->start(); }
+	private:
+		TTimer* m_timer;
+	};
+
+	// Times one hold of a lock.  The disabled timer is empty and all its members are no-ops, so
+	// a locked pointer that carries one (CJM_SYNCHRO_NO_UNIQUE_ADDRESS) is unchanged.
+	template<bool Enabled>
+	class hold_timer
+	{
+	public:
+		static constexpr bool enabled = false;
+		struct pause_t {};
+
+		constexpr void start() noexcept {}
+		template<typename TSite>
+		constexpr void start(const TSite&) noexcept {}
+		template<typename TStats>
+		constexpr void stop(TStats&) noexcept {}
+		template<typename TStats>
+		[[nodiscard]] constexpr pause_t pause(TStats&) noexcept { return {}; }
+	};
+
+	// Times a random one in sample_period holds: the two clock reads are most of what stats
+	// cost an uncontended acquisition, and the histogram's shape (which is all percentile_ns
+	// looks at) survives sampling.  The choice is random per thread rather than every n-th,
+	// so a loop that alternates between vaults does not sample only one of them.
+	template<>
+	class hold_timer<true>
+	{
+	public:
+		static constexpr bool enabled = true;
+		static constexpr std::uint32_t sample_period = 8;
+		using clock_t = stats_clock;
+		static constexpr clock_t::time_point not_sampled = clock_t::time_point::min();
+
+		void start() noexcept { m_start = sampled() ? clock_t::now() : not_sampled; }
+		void start(const no_call_site&) noexcept { start(); }
+
+		template<typename TStats>
+		void stop(TStats& stats) noexcept
+		{
+			if (m_start != not_sampled)
+			{
+				stats.record_hold(clock_t::now() - m_start);
+			}
+		}
+
+		template<typename TStats>
+		[[nodiscard]] hold_pause<hold_timer, TStats> pause(TStats& stats) noexcept { return hold_pause<hold_timer, TStats>{ *this, stats }; }
+
+		// xorshift32, seeded from the thread's own address for it.
+		[[nodiscard]] static bool sampled() noexcept
+		{
+			thread_local std::uint32_t state = 0;
+			if (state == 0) [[unlikely]]
+			{
+				state = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&state) >> 4) | 1;
+			}
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return state % sample_period == 0;
+		}
+
+	private:
+		clock_t::time_point m_start{ not_sampled };
+	};
+
+	struct no_vault_stats
+	{
+		static constexpr bool enabled = false;
+		static constexpr bool traced = false;
+		using hold_timer_t = hold_timer<false>;
+		using site_t = no_call_site;
+
+		template<typename TLock>
+		static void lock(TLock& lck, const site_t&) { lck.lock(); }
+
+		template<typename TLock>
+		static void adopt(TLock&, const site_t&) noexcept {}
+	};
+
+	// Per-vault counters for stats_policy::enabled.  Every thread with a thread_index gets a
+	// shard of its own, allocated the first time it records here, and is its only writer, so
+	// a count is a plain load and store rather than a locked add; threads without an index
+	// share one more shard and do pay for the atomic add.  Registers with stats_registry for
+	// its lifetime; ctrl_block is never moved, so the address stays valid.
+	class vault_stats
+	{
+	public:
+		static constexpr bool enabled = true;
+		static constexpr bool traced = false;
+		static constexpr std::size_t bucket_count = vault_stats_snapshot::bucket_count;
+		using hold_timer_t = hold_timer<true>;
+		using site_t = no_call_site;
+		using clock_t = hold_timer_t::clock_t;
+
+		vault_stats();
+		vault_stats(const vault_stats& other) = delete;
+		vault_stats(vault_stats&& other) noexcept = delete;
+		vault_stats& operator=(const vault_stats& other) = delete;
+		vault_stats& operator=(vault_stats&& other) noexcept = delete;
+		~vault_stats();
+
+		// Tries first, so an acquisition that has to wait is known to be contended.
+		template<typename TLock>
+		void lock(TLock& lck, const site_t&)
+		{
+			if (lck.try_lock())
+			{
+				record_acquisition(false, clock_t::duration::zero());
+				return;
+			}
+			const auto start = clock_t::now();
+			lck.lock();
+			record_acquisition(true, clock_t::now() - start);
+		}
+
+		// For a lock the vault adopts rather than takes (try_lock and its timed forms, lock_all,
+		// combining, an async grant): counted as an uncontended acquisition.
+		template<typename TLock>
+		void adopt(TLock&, const site_t&) noexcept
+		{
+			record_acquisition(false, clock_t::duration::zero());
+		}
+
+		void record_hold(clock_t::duration held) noexcept
+		{
+			const auto shard = local();
+			shard.bump(shard.counters.hold[bucket_for(held)]);
+		}
+
+		void record_wakeup(bool spurious) noexcept
+		{
+			const auto shard = local();
+			shard.bump(shard.counters.wakeups);
+			if (spurious)
+			{
+				shard.bump(shard.counters.spurious_wakeups);
+			}
+		}
+
+		// Wraps a wait predicate: every evaluation after the first follows a wakeup, which was
+		// spurious if the predicate is still false.
+		template<typename TPredicate>
+		[[nodiscard]] auto count_wakeups(TPredicate& predicate, bool& woken) noexcept
+		{
+			return [this, &predicate, &woken]() -> bool
+			{
+				const bool ready = static_cast<bool>(predicate());
+				if (woken)
+				{
+					record_wakeup(!ready);
+				}
+				woken = true;
+				return ready;
+			};
+		}
+
+		void set_name(std::string name);
+		[[nodiscard]] vault_stats_snapshot snapshot() const;
+
+	protected:
+		void record_acquisition(bool contended, clock_t::duration waited) noexcept
+		{
+			const auto shard = local();
+			shard.bump(shard.counters.acquisitions);
+			if (contended)
+			{
+				shard.bump(shard.counters.contended_acquisitions);
+			}
+			shard.bump(shard.counters.wait[bucket_for(waited)]);
+		}
+
+	private:
+		friend class cjm::synchro::stats_registry;
+
+		struct alignas(cache_line_size) shard_t
+		{
+			std::atomic<std::uint64_t> acquisitions{ 0 };
+			std::atomic<std::uint64_t> contended_acquisitions{ 0 };
+			std::atomic<std::uint64_t> wakeups{ 0 };
+			std::atomic<std::uint64_t> spurious_wakeups{ 0 };
+			std::array<std::atomic<std::uint64_t>, bucket_count> wait{};
+			std::array<std::atomic<std::uint64_t>, bucket_count> hold{};
+		};
+
+		[[nodiscard]] static std::size_t bucket_for(clock_t::duration d) noexcept
+		{
+			const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+			const auto width = static_cast<std::size_t>(std::bit_width(static_cast<std::uint64_t>(ns > 0 ? ns : 0)));
+			return width < bucket_count ? width : bucket_count - 1;
+		}
+
+		// Counters are atomic only so that snapshot_counters() may read them while they change.
+		struct local_t
+		{
+			shard_t& counters;
+			bool owned;
+
+			void bump(std::atomic<std::uint64_t>& counter) const noexcept
+			{
+				if (owned)
+					counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				else
+					counter.fetch_add(1, std::memory_order_relaxed);
+			}
+		};
+
+		[[nodiscard]] local_t local() noexcept
+		{
+			const std::size_t index = thread_index::current();
+			if (index < thread_index::capacity)
+			{
+				shard_t* shard = m_owned[index].load(std::memory_order_relaxed);
+				if (shard == nullptr) [[unlikely]]
+				{
+					shard = new (std::nothrow) shard_t{};
+					m_owned[index].store(shard, std::memory_order_release);
+				}
+				if (shard != nullptr)
+				{
+					return local_t{ *shard, true };
+				}
+			}
+			return local_t{ m_shared, false };
+		}
+
+		[[nodiscard]] vault_stats_snapshot snapshot_counters() const noexcept;
+
+		std::array<std::atomic<shard_t*>, thread_index::capacity> m_owned{};
+		shard_t m_shared{};
+		// Guarded by the registry's mutex, as is the list linkage.
+		std::string m_name;
+		vault_stats* m_prev{ nullptr };
+		vault_stats* m_next{ nullptr };
+	};
+
+	// Defined in cjm_synchro_trace.hpp, which cjm_synchro.hpp includes.
+	class traced_vault_stats;
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	using vault_stats_for_t = std::conditional_t<trace_enabled_v<TLocked, TMutex, Level>, traced_vault_stats,
+		std::conditional_t<stats_enabled_v<TLocked, TMutex, Level>, vault_stats, no_vault_stats>>;
+
+	// Scoped lock for the vault's own short critical sections (copy_locked_datum and friends)
+	// that also records the hold.
+	template<typename TLock, typename TStats>
+	class counted_lock
+	{
+	public:
+		counted_lock(TStats& stats, typename TLock::mutex_type& mutex, const typename TStats::site_t& site)
+			: m_stats{ &stats }, m_lock{ mutex, defer_lock_for<TLock>() }
+		{
+			stats.lock(m_lock, site);
+			m_timer.start(site);
+		}
+		counted_lock(const counted_lock& other) = delete;
+		counted_lock(counted_lock&& other) noexcept = delete;
+		counted_lock& operator=(const counted_lock& other) = delete;
+		counted_lock& operator=(counted_lock&& other) noexcept = delete;
+		~counted_lock()
+		{
+			m_timer.stop(*m_stats);
+		}
+
+	private:
+		TStats* m_stats;
+		TLock m_lock;
+		typename TStats::hold_timer_t m_timer;
+	};
+
+	// Every lock a vault takes on its mutex goes through these.  With stats disabled they are
+	// exactly TLock{ mutex }.  A traced vault's own datum operations are labelled with the
+	// operation inside the vault, since they take no call site.
+	template<typename TLock, typename TStats, typename TMutex>
+	[[nodiscard]] TLock acquire_lock(TStats& stats, TMutex& mutex, const typename TStats::site_t& site)
+	{
+		if constexpr (TStats::enabled)
+		{
+			auto lck = TLock{ mutex, defer_lock_for<TLock>() };
+			stats.lock(lck, site);
+			return lck;
+		}
+		else
+		{
+			return TLock{ mutex };
+		}
+	}
+
+	template<typename TLock, typename TStats, typename TMutex>
+	[[nodiscard]] auto scoped_acquire(TStats& stats, TMutex& mutex,
+		const typename TStats::site_t& site = TStats::site_t::current())
+	{
+		if constexpr (TStats::enabled)
+			return counted_lock<TLock, TStats>{ stats, mutex, site };
+		else
+			return TLock{ mutex };
+	}
+}
+
+namespace cjm::synchro
+{
+	// Directory of the vaults that have stats enabled, for finding the hot ones in a running
+	// process.  Vaults add themselves on construction and leave on destruction.
+	class stats_registry
+	{
+	public:
+		[[nodiscard]] static stats_registry& instance()
+		{
+			static stats_registry registry;
+			return registry;
+		}
+
+		stats_registry(const stats_registry& other) = delete;
+		stats_registry(stats_registry&& other) noexcept = delete;
+		stats_registry& operator=(const stats_registry& other) = delete;
+		stats_registry& operator=(stats_registry&& other) noexcept = delete;
+
+		[[nodiscard]] std::vector<vault_stats_snapshot> snapshot() const
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			std::vector<vault_stats_snapshot> ret;
+			for (const detail::vault_stats* stats = m_head; stats != nullptr; stats = stats->m_next)
+			{
+				ret.push_back(stats->snapshot_counters());
+				ret.back().name = stats->m_name;
+			}
+			return ret;
+		}
+
+		// One line per live vault.  Percentiles are bucket upper bounds.
+		void dump(std::ostream& os) const
+		{
+			for (const auto& stats : snapshot())
+			{
+				if (stats.name.empty())
+					os << "vault@" << stats.address;
+				else
+					os << stats.name;
+				os << " acquisitions=" << stats.acquisitions
+					<< " contended=" << stats.contended_acquisitions
+					<< " wait_p50<=" << vault_stats_snapshot::percentile_ns(stats.wait_ns, 0.5) << "ns"
+					<< " wait_p99<=" << vault_stats_snapshot::percentile_ns(stats.wait_ns, 0.99) << "ns"
+					<< " hold_p50<=" << vault_stats_snapshot::percentile_ns(stats.hold_ns, 0.5) << "ns"
+					<< " hold_p99<=" << vault_stats_snapshot::percentile_ns(stats.hold_ns, 0.99) << "ns"
+					<< " wakeups=" << stats.wakeups
+					<< " spurious=" << stats.spurious_wakeups << '\n';
+			}
+		}
+
+	private:
+		friend detail::vault_stats;
+
+		stats_registry() noexcept = default;
+		~stats_registry() = default;
+
+		void add(detail::vault_stats& stats) noexcept
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			stats.m_next = m_head;
+			if (m_head != nullptr)
+			{
+				m_head->m_prev = &stats;
+			}
+			m_head = &stats;
+		}
+
+		void remove(detail::vault_stats& stats) noexcept
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			(stats.m_prev == nullptr ? m_head : stats.m_prev->m_next) = stats.m_next;
+			if (stats.m_next != nullptr)
+			{
+				stats.m_next->m_prev = stats.m_prev;
+			}
+		}
+
+		void rename(detail::vault_stats& stats, std::string name)
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			stats.m_name = std::move(name);
+		}
+
+		[[nodiscard]] std::string name_of(const detail::vault_stats& stats) const
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			return stats.m_name;
+		}
+
+		mutable std::mutex m_mutex;
+		detail::vault_stats* m_head{ nullptr };
+	};
+}
+
+namespace cjm::synchro::detail
+{
+	inline vault_stats::vault_stats()
+	{
+		stats_registry::instance().add(*this);
+	}
+
+	inline vault_stats::~vault_stats()
+	{
+		stats_registry::instance().remove(*this);
+		for (auto& owned : m_owned)
+		{
+			delete owned.load(std::memory_order_relaxed);
+		}
+	}
+
+	inline void vault_stats::set_name(std::string name)
+	{
+		stats_registry::instance().rename(*this, std::move(name));
+	}
+
+	inline vault_stats_snapshot vault_stats::snapshot() const
+	{
+		auto ret = snapshot_counters();
+		ret.name = stats_registry::instance().name_of(*this);
+		return ret;
+	}
+
+	inline vault_stats_snapshot vault_stats::snapshot_counters() const noexcept
+	{
+		vault_stats_snapshot ret;
+		ret.address = this;
+		const auto add = [&ret](const shard_t& shard) noexcept
+		{
+			ret.acquisitions += shard.acquisitions.load(std::memory_order_relaxed);
+			ret.contended_acquisitions += shard.contended_acquisitions.load(std::memory_order_relaxed);
+			ret.wakeups += shard.wakeups.load(std::memory_order_relaxed);
+			ret.spurious_wakeups += shard.spurious_wakeups.load(std::memory_order_relaxed);
+			for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+			{
+				ret.wait_ns[bucket] += shard.wait[bucket].load(std::memory_order_relaxed);
+				ret.hold_ns[bucket] += shard.hold[bucket].load(std::memory_order_relaxed);
+			}
+		};
+		add(m_shared);
+		for (const auto& owned : m_owned)
+		{
+			if (const shard_t* shard = owned.load(std::memory_order_acquire))
+			{
+				add(*shard);
+			}
+		}
+		return ret;
+	}
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class ctrl_block;
+
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class locked_ptr_base;
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class scoped_unlock;
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class synchro_vault_base;
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class shared_locked_ptr_base;
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class upgrade_locked_ptr_base;
+
+	template<typename TMutex>
+	concept provides_condition_variable = requires { typename TMutex::condition_variable_type; };
+
+	template<typename TMutex, concepts::mutex_level Level>
+	struct condition_variable_for
+	{
+		using type = std::conditional_t<Level == concepts::mutex_level::std_mutex, std::condition_variable, std::condition_variable_any>;
+	};
+
+	template<provides_condition_variable TMutex, concepts::mutex_level Level>
+	struct condition_variable_for<TMutex, Level>
+	{
+		using type = typename TMutex::condition_variable_type;
+	};
+
+	template<typename TMutex, concepts::mutex_level Level>
+	using condition_variable_for_t = typename condition_variable_for<TMutex, Level>::type;
+
+	template<typename TCondition, typename TLock, typename TPredicate, typename... TExecutor>
+	concept async_waitable_condition = requires (TCondition & condition, TLock & lock, TPredicate p, TExecutor&... executor)
+	{
+		condition.wait_async(lock, std::move(p), executor...);
+	};
+
+	// Condition variable reduced to a generation counter.  A waiter reads the generation while
+	// it still holds the lock and then sleeps in std::atomic::wait (a futex on Linux,
+	// WaitOnAddress on Windows) until it changes; every notify bumps it, so a notification that
+	// lands between the unlock and the sleep is never lost.  Four bytes, no internal mutex.
+	// std::atomic::wait has no timeout, so timed waiters park on the word in the parking_lot
+	// instead and set its low bit, which tells a notifier to unpark them as well; the
+	// generation counts in twos above it.
+	class futex_condition
+	{
+	public:
+		futex_condition() noexcept = default;
+		futex_condition(const futex_condition& other) = delete;
+		futex_condition(futex_condition&& other) noexcept = delete;
+		futex_condition& operator=(const futex_condition& other) = delete;
+		futex_condition& operator=(futex_condition&& other) noexcept = delete;
+		~futex_condition() = default;
+
+		// The bit is cleared under the bucket lock once no timed waiter is left, so a waiter
+		// parking concurrently either sets it again afterwards or is still in the queue.
+		void notify_one() noexcept
+		{
+			const std::uint32_t previous = m_state.fetch_add(generation_step, std::memory_order_acq_rel);
+			m_state.notify_one();
+			if ((previous & timed_waiters) != 0)
+			{
+				parking_lot::unpark_one(&m_state, [this](parking_lot::unpark_result result)
+				{
+					if (!result.may_have_more)
+					{
+						m_state.fetch_and(~timed_waiters, std::memory_order_relaxed);
+					}
+				});
+			}
+		}
+
+		void notify_all() noexcept
+		{
+			const std::uint32_t previous = m_state.fetch_add(generation_step, std::memory_order_acq_rel);
+			m_state.notify_all();
+			if ((previous & timed_waiters) != 0)
+			{
+				m_state.fetch_and(~timed_waiters, std::memory_order_relaxed);
+				parking_lot::unpark_all(&m_state);
+			}
+		}
+
+		// A timed waiter setting the bit changes the word without a notify, hence the loop.
+		template<typename TLock>
+		void wait(TLock& lock)
+		{
+			const std::uint32_t generation = m_state.load(std::memory_order_relaxed) & ~timed_waiters;
+			lock.unlock();
+			for (std::uint32_t state = m_state.load(std::memory_order_acquire); (state & ~timed_waiters) == generation;
+				state = m_state.load(std::memory_order_acquire))
+			{
+				m_state.wait(state, std::memory_order_acquire);
+			}
+			lock.lock();
+		}
+
+		template<typename TLock, std::predicate Predicate>
+		void wait(TLock& lock, Predicate p)
+		{
+			while (!p())
+			{
+				wait(lock);
+			}
+		}
+
+		// The validation runs under the bucket lock before the lock is released: a notify that
+		// bumped the generation first makes it fail (and the wait return at once, lock held),
+		// and one that comes after sees the bit and unparks this thread.
+		template<typename TLock, typename TClock, typename TDuration>
+		std::cv_status wait_until(TLock& lock, const std::chrono::time_point<TClock, TDuration>& deadline)
+		{
+			const std::uint32_t generation = m_state.load(std::memory_order_relaxed) & ~timed_waiters;
+			bool unlocked = false;
+			const auto result = parking_lot::park_until(&m_state, [this, generation]
+			{
+				return (m_state.fetch_or(timed_waiters, std::memory_order_acq_rel) & ~timed_waiters) == generation;
+			}, [&lock, &unlocked]
+			{
+				lock.unlock();
+				unlocked = true;
+			}, deadline);
+			if (unlocked)
+			{
+				lock.lock();
+			}
+			return result == parking_lot::park_result::timed_out ? std::cv_status::timeout : std::cv_status::no_timeout;
+		}
+
+		template<typename TLock, typename TClock, typename TDuration, std::predicate Predicate>
+		bool wait_until(TLock& lock, const std::chrono::time_point<TClock, TDuration>& deadline, Predicate p)
+		{
+			while (!p())
+			{
+				if (wait_until(lock, deadline) == std::cv_status::timeout)
+				{
+					return p();
+				}
+			}
+			return true;
+		}
+
+		template<typename TLock, typename TRep, typename TPeriod>
+		std::cv_status wait_for(TLock& lock, const std::chrono::duration<TRep, TPeriod>& d)
+		{
+			return wait_until(lock, std::chrono::steady_clock::now() + d);
+		}
+
+		template<typename TLock, typename TRep, typename TPeriod, std::predicate Predicate>
+		bool wait_for(TLock& lock, const std::chrono::duration<TRep, TPeriod>& d, Predicate p)
+		{
+			return wait_until(lock, std::chrono::steady_clock::now() + d, std::move(p));
+		}
+
+	private:
+		static constexpr std::uint32_t timed_waiters = 1;
+		static constexpr std::uint32_t generation_step = 2;
+
+		std::atomic<std::uint32_t> m_state{ 0 };
+	};
+
+	// Stand-in for vaults declared non-waitable.  Nothing can wait on it; the notify members
+	// exist only so the release path compiles, and fold away.
+	struct no_condition
+	{
+		constexpr void notify_one() const noexcept {}
+		constexpr void notify_all() const noexcept {}
+	};
+
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level, typename TDefault>
+	using vault_condition_t = std::conditional_t<wait_policy_for<TLocked, TMutex, Level>() == wait_policy::futex, futex_condition,
+		std::conditional_t<wait_policy_for<TLocked, TMutex, Level>() == wait_policy::none, no_condition, TDefault>>;
+
+	// Member alignments for the ctrl_block layout_policy.  Every policy keeps the members in
+	// their original order (mutex, condition variable, datum), so packed is the layout vaults
+	// always had; the padded policies only add alignment.  Empty members are never padded, so
+	// a policy costs nothing for the parts a vault does not store.
+	template<typename TLocked, typename TMutex, concepts::mutex_level Level>
+	struct ctrl_block_layout
+	{
+		static constexpr layout_policy policy = layout_policy_for<TLocked, TMutex, Level>();
+
+		template<typename T>
+		static constexpr std::size_t line_aligned(bool pad) noexcept
+		{
+			return pad && !std::is_empty_v<T> ? std::max(cache_line_size, alignof(T)) : alignof(T);
+		}
+
+		template<typename T>
+		static constexpr std::size_t lock_align = line_aligned<T>(policy != layout_policy::packed);
+		template<typename T>
+		static constexpr std::size_t hot_align = line_aligned<T>(policy == layout_policy::isolated_mutex);
+		template<typename T>
+		static constexpr std::size_t cold_align = line_aligned<T>(policy == layout_policy::isolated_mutex);
+	};
+
+	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
+	class ctrl_block
+	{
+	protected:
+		static constexpr concepts::mutex_level level = Level;
+	
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, Level>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, Level>;
+		using locked_datum_t = std::remove_reference_t<TLocked>;
+		using const_locked_datum_t = std::add_const_t<locked_datum_t>;
+		using locked_datum_ref_t = std::add_lvalue_reference_t<locked_datum_t>;
+		using const_locked_datum_ref_t = std::add_lvalue_reference_t<const_locked_datum_t>;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using shared_lock_t = std::conditional_t<level == concepts::mutex_level::shared || level == concepts::mutex_level::upgrade, std::shared_lock<mutex_t>, void>;
+		using upgrade_lock_t = std::conditional_t<using_boost&& level == concepts::mutex_level::upgrade, boost::upgrade_lock<TMutex>, void>;
+		using condition_variable_t = vault_condition_t<TLocked, TMutex, Level, condition_variable_for_t<TMutex, Level>>;
+		using stats_t = vault_stats_for_t<TLocked, TMutex, Level>;
+		using call_site_t = typename stats_t::site_t;
+		using layout_t = ctrl_block_layout<TLocked, TMutex, Level>;
+		using ptr_to_locked_datum = std::add_pointer_t<locked_datum_t>;
+		using ptr_to_const_locked_datum = std::add_pointer_t<const_locked_datum_t>;
+		using const_ptr_to_locked_datum = std::add_const_t<ptr_to_const_locked_datum>;
+		using const_ptr_to_const_locked_datum = std::add_const_t<ptr_to_const_locked_datum>;
+		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ptr_to_locked_datum>;
+		using vault_owner_t = synchro_vault_base<TLocked, TMutex, Level>;
+		using locked_ptr_t = locked_ptr_base<TLocked, TMutex, Level>;
+		static constexpr concepts::time_type condition_variable_time = concepts::time_type::std;
+		friend locked_ptr_t;
+		friend scoped_unlock_t;
+		friend synchro_vault_t;
+
+		std::pair<lock_t, ctrl_block*> lock_impl() const
+		{
+			return std::make_pair(lock_t{ m_mutex }, this);
+		}
+	public:
+		ctrl_block(const ctrl_block& cb) = delete;
+		ctrl_block(ctrl_block&& cb) noexcept = delete;
+		ctrl_block& operator=(const ctrl_block& cb) = delete;
+		ctrl_block& operator=(ctrl_block&& cb) noexcept = delete;
+		~ctrl_block() = default;
+	protected:
+		ctrl_block() noexcept(std::is_nothrow_default_constructible_v<locked_datum_t>)
+			requires (std::is_default_constructible_v<locked_datum_t>)
+			: m_mutex{}, m_condition_variable{}, m_locked{} {}
+		explicit ctrl_block(const locked_datum_t & locked)
+			noexcept(std::is_nothrow_copy_constructible_v<locked_datum_t>)
+			requires std::copy_constructible<locked_datum_t> : m_mutex{}, m_condition_variable{}, m_locked{ locked } {}
+
+
+		explicit ctrl_block(locked_datum_t && locked)
+			noexcept(std::is_nothrow_move_constructible_v<locked_datum_t>)
+			requires (std::move_constructible<locked_datum_t>) : m_mutex{}, m_condition_variable{}, m_locked{ std::move(locked) } {}
+		template<typename...TArgs>
+		requires (std::constructible_from<locked_datum_t, TArgs...>)
+			ctrl_block(TArgs&&... args)
+			noexcept(cjm::concepts::nothrow_constructible_from<locked_datum_t,
+				TArgs...>)
+			: m_mutex{}, m_condition_variable{},
+			m_locked{ std::forward<TArgs>(args)... } {}
+		alignas(layout_t::template lock_align<mutex_t>) mutable mutex_t m_mutex;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS alignas(layout_t::template cold_align<condition_variable_t>)
+			mutable condition_variable_t m_condition_variable;
+		alignas(layout_t::template hot_align<locked_datum_t>) locked_datum_t m_locked;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS mutable stats_t m_stats;
+	};
+	
+	template<typename TLocked>
+	class ctrl_block<TLocked, std::mutex, concepts::mutex_level::std_mutex>
+	{
+	protected:
+		using synchro_vault_t = synchro_vault_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using scoped_unlock_t = scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using locked_datum_t = std::remove_reference_t<TLocked>;
+		using mutex_t = std::mutex;
+		using lock_t = std::unique_lock<std::mutex>;
+		using condition_variable_t = vault_condition_t<TLocked, std::mutex, concepts::mutex_level::std_mutex, std::condition_variable>;
+		using stats_t = vault_stats_for_t<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using call_site_t = typename stats_t::site_t;
+		using layout_t = ctrl_block_layout<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using ptr_to_locked = locked_datum_t*;
+		using ptr_to_locked_datum = ptr_to_locked;
+		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ptr_to_locked>;
+		using vault_owner_t = synchro_vault_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using locked_ptr_t = locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		static constexpr concepts::time_type condition_variable_time = concepts::time_type::std;
+		static constexpr concepts::mutex_level level = concepts::mutex_level::std_mutex;
+		friend locked_ptr_t;
+		friend scoped_unlock_t;
+		friend synchro_vault_t;
+
+		std::pair<lock_t, ctrl_block*> lock_impl() const
+		{
+			return std::make_pair(lock_t{ m_mutex }, this);
+		}
+
+	public:
+		ctrl_block(const ctrl_block& cb) = delete;
+		ctrl_block(ctrl_block&& cb) noexcept = delete;
+		ctrl_block& operator=(const ctrl_block& cb) = delete;
+		ctrl_block& operator=(ctrl_block&& cb) noexcept = delete;
+		~ctrl_block() = default;
+	protected:
+		ctrl_block() noexcept(std::is_nothrow_default_constructible_v<locked_datum_t>)
+			requires (std::is_default_constructible_v<locked_datum_t>)
+			: m_mutex{}, m_condition_variable{}, m_locked{} {}
+		explicit ctrl_block(const locked_datum_t& locked)
+			noexcept(std::is_nothrow_copy_constructible_v<locked_datum_t>)
+			requires std::copy_constructible<locked_datum_t> : m_mutex{}, m_condition_variable{}, m_locked{locked} {}
+
+		
+		explicit ctrl_block(locked_datum_t&& locked)
+			noexcept(std::is_nothrow_move_constructible_v<locked_datum_t>)
+			requires (std::move_constructible<locked_datum_t>) : m_mutex{}, m_condition_variable{}, m_locked{std::move(locked)} {}
+		template<typename...TArgs>
+			requires (std::constructible_from<locked_datum_t, TArgs...>)
+		ctrl_block(TArgs&&... args)
+			noexcept(cjm::concepts::nothrow_constructible_from<locked_datum_t, 
+				TArgs...>)			
+				: m_mutex{}, m_condition_variable{},
+					m_locked{ std::forward<TArgs>(args)... } {}
+
+		alignas(layout_t::template lock_align<mutex_t>) mutable mutex_t m_mutex;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS alignas(layout_t::template cold_align<condition_variable_t>)
+			mutable condition_variable_t m_condition_variable;
+		alignas(layout_t::template hot_align<locked_datum_t>) locked_datum_t m_locked;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS mutable stats_t m_stats;
+	};
+	template<typename TLocked>
+	class locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>
+	{
+	public:
+		using release_notifier_t = release_notifier_for_t<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using scoped_unlock_t = scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		friend class scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using locked_t = std::remove_reference_t<TLocked>;
+		using mutex_t = std::mutex;
+		using lock_t = std::unique_lock<std::mutex>;
+		using locked_ptr_t = std::add_pointer_t<lock_t>;
+		using ctrl_blck_t = ctrl_block<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using synchro_vault_t = synchro_vault_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		friend ctrl_blck_t;
+		friend synchro_vault_t;
+		using ctrl_blck_ptr_t = std::add_pointer_t<ctrl_blck_t>;
+		using stats_t = typename ctrl_blck_t::stats_t;
+		using hold_timer_t = typename stats_t::hold_timer_t;
+		static constexpr concepts::time_type condition_variable_time = ctrl_blck_t::condition_variable_time;
+
+		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ctrl_blck_ptr_t>;
+		~locked_ptr_base();
+		locked_ptr_base(const locked_ptr_base& other) = delete;
+		locked_ptr_base(locked_ptr_base&& other) noexcept
+			: m_release_notifier{ std::move(other.m_release_notifier) },
+			m_lock{ std::move(other.m_lock) }, m_ctrl_blck{ std::exchange(other.m_ctrl_blck, nullptr) },
+			m_hold_timer{ other.m_hold_timer } {}
+		locked_ptr_base& operator=(const locked_ptr_base& other) = delete;
+		locked_ptr_base& operator=(locked_ptr_base&& other) noexcept;
+
+	protected:
+
+		lock_release_notify lock_release_setting() const noexcept
+		{
+			return m_release_notifier.setting();
+		}
+
+		void release_impl() noexcept;
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock_impl(const call_site_t& site);
+
+		void notify_one_impl()
+		{
+			m_ctrl_blck->m_condition_variable.notify_one();
+		}
+
+		void notify_all_impl()
+		{
+			m_ctrl_blck->m_condition_variable.notify_all();
+		}
+
+		void set_cv_release_notification(lock_release_notify lrn)
+			requires (release_notifier_t::policy == release_notify_policy::runtime)
+		{
+			assert(lrn >= lock_release_notify::none && lrn <= lock_release_notify::all);
+			m_release_notifier.set(lrn);
+		}
+
+		template<concepts::duration Duration>
+		void wait_for_impl(const Duration& d)
+		{
+			assert(is_locked_impl());
+			static_assert(
+				(concepts::detail::std_duration<Duration> ||
+					concepts::detail::boost_duration<Duration>)
+				&&
+				!(concepts::detail::std_duration<Duration> &&
+					concepts::detail::boost_duration<Duration>));
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_for(m_lock, d);
+		}
+
+		template<concepts::duration Duration, std::predicate Predicate>
+		void wait_for_impl(const Duration& d, Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_for(m_lock, d, p);
+		}
+
+		template<concepts::time_point TimePoint>
+		void wait_until_impl(const TimePoint& tp)
+		{
+			assert(is_locked_impl());
+			static_assert(
+				(concepts::detail::boost_time_point<TimePoint> ||
+					concepts::detail::std_time_point<TimePoint>)
+				&&
+				!(concepts::detail::boost_time_point<TimePoint> &&
+					concepts::detail::std_time_point<TimePoint>));
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp);
+		}
+
+		template<concepts::time_point TimePoint, std::predicate Predicate>
+		void wait_until_impl(const TimePoint& tp, Predicate p)
+		{
+			assert(is_locked_impl());
+			static_assert(
+				(concepts::detail::boost_time_point<TimePoint> ||
+					concepts::detail::std_time_point<TimePoint>)
+				&&
+				!(concepts::detail::boost_time_point<TimePoint> &&
+					concepts::detail::std_time_point<TimePoint>));
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp, p);
+		}
+
+		void wait_impl()
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait(m_lock);
+		}
+
+		template<std::predicate Predicate>
+		void wait_impl(Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				bool woken = false;
+				m_ctrl_blck->m_condition_variable.wait(m_lock, m_ctrl_blck->m_stats.count_wakeups(p, woken));
+			}
+			else
+			{
+				m_ctrl_blck->m_condition_variable.wait(m_lock, p);
+			}
+		}
+
+		[[nodiscard]] std::add_lvalue_reference_t<locked_t> locked_value() const;
+
+
+		[[nodiscard]] bool is_empty_impl() const noexcept
+		{
+			return get_mutex_impl() == nullptr && m_ctrl_blck == nullptr;
+		}
+
+		void lock_impl(unlocker_data_t unlocker_data, const call_site_t& site)
+		{
+			assert(!is_locked_impl());
+			m_lock = std::move(unlocker_data.first);
+			m_ctrl_blck = unlocker_data.second;
+			assert(m_ctrl_blck != nullptr && m_lock.mutex() != nullptr && !m_lock.owns_lock());
+			if constexpr (stats_t::enabled)
+			{
+				m_ctrl_blck->m_stats.lock(m_lock, site);
+				m_hold_timer.start();
+			}
+			else
+			{
+				m_lock.lock();
+			}
+			assert(is_locked_impl());
+		}
+
+		unlocker_data_t unlock_impl()
+		{
+			assert(is_locked_impl());
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
+			unlocker_data_t ret = std::make_pair(std::move(m_lock), m_ctrl_blck);
+			m_ctrl_blck = nullptr;
+			ret.first.unlock();
+			assert(ret.second != nullptr && !is_locked_impl() && is_empty_impl());
+			return ret;
+		}
+
+		[[nodiscard]] bool is_locked_impl() const noexcept
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			return m_lock.owns_lock();
+		}
+
+		[[nodiscard]] mutex_t* get_mutex_impl() const noexcept
+		{
+			return m_lock.mutex();
+		}
+
+		explicit locked_ptr_base(std::unique_lock<mutex_t> lock, ctrl_blck_ptr_t locked, const call_site_t& site = call_site_t{}) : m_lock{ std::move(lock) }, m_ctrl_blck{ locked }
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			if constexpr (stats_t::enabled)
+			{
+				if (m_lock.owns_lock())
+				{
+					m_hold_timer.start(site);
+				}
+			}
+		}
+		locked_ptr_base() = default;
+	private:
+
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS release_notifier_t m_release_notifier;
+		lock_t m_lock;
+		ctrl_blck_ptr_t m_ctrl_blck{nullptr};
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS hold_timer_t m_hold_timer;
+	};
+
+
+
+	template <typename TLocked>
+	class scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>
+	{
+	public:
+		using locked_ptr_base_t = locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using unlocker_data_t = typename locked_ptr_base_t::unlocker_data_t;
+		using call_site_t = typename locked_ptr_base_t::call_site_t;
+		scoped_unlock& operator=(scoped_unlock&& other) noexcept = delete;
+		scoped_unlock& operator=(const scoped_unlock& other) = delete;
+		scoped_unlock() = delete;
+		scoped_unlock(scoped_unlock&& other) noexcept = delete;
+		scoped_unlock(const scoped_unlock& other) = delete;
+		explicit scoped_unlock(locked_ptr_base_t& locked_ptr, const call_site_t& site) : m_unlocker_data{}, m_ptr(&locked_ptr), m_site{ site }
+		{
+			assert(locked_ptr.is_locked_impl());
+			m_unlocker_data = locked_ptr.unlock_impl();
+			assert(!m_ptr->is_locked_impl() && m_unlocker_data.second != nullptr);
+		}
+		~scoped_unlock()
+		{
+			assert(static_cast<bool>(m_ptr) && !m_ptr->is_locked_impl());
+			m_ptr->lock_impl(std::move(m_unlocker_data), m_site);
+			assert(m_ptr->is_locked_impl());
+		}
+
+	private:
+		unlocker_data_t m_unlocker_data;
+		locked_ptr_base_t* m_ptr;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS call_site_t m_site;
+	};
+
+	template<typename TLocked>
+	class synchro_vault_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>
+	{
+	protected:
+		using ctrl_blck_t = ctrl_block<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using scoped_unlock_t = scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using locked_t = typename ctrl_blck_t::locked_datum_t;
+		using mutex_t = typename ctrl_blck_t::mutex_t;
+		using lock_t = typename ctrl_blck_t::lock_t;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using ptr_to_locked = typename ctrl_blck_t::ptr_to_locked_datum;
+		using unlocker_data_t = typename ctrl_blck_t::unlocker_data_t;
+		using vault_owner_t = typename ctrl_blck_t::vault_owner_t;
+		static_assert(std::is_same_v<synchro_vault_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>, vault_owner_t>);
+		using locked_ptr_t = typename ctrl_blck_t::locked_ptr_t;
+		friend ctrl_blck_t;
+		friend scoped_unlock_t;		
+
+		synchro_vault_base() noexcept(std::is_nothrow_default_constructible_v<locked_t>)
+			requires (std::is_default_constructible_v<locked_t>) : m_ctrl_blck{} {}
+		synchro_vault_base(const locked_t& locked_datum) noexcept(std::is_nothrow_copy_constructible_v<locked_t>)
+			requires (std::copy_constructible<locked_t>) : m_ctrl_blck{ locked_datum } {}
+		synchro_vault_base(locked_t&& locked_datum) noexcept(std::is_nothrow_move_constructible_v<locked_t>)
+			requires (std::move_constructible<locked_t>) : m_ctrl_blck{ std::move(locked_datum) } {}
+		template<typename...TArgs>
+		requires (std::constructible_from<locked_t, TArgs...>)
+			synchro_vault_base(TArgs&&... args) noexcept(cjm::concepts::nothrow_constructible_from<locked_t,
+				TArgs...>) : m_ctrl_blck{ std::forward<TArgs>(args)... } {}
+
+		[[nodiscard]] locked_ptr_t lock_impl(const call_site_t& site)
+		{
+			return locked_ptr_t{ acquire_lock<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex, site), &m_ctrl_blck, site };
+		}
+
+		[[nodiscard]] lock_t defer_lock_impl() const
+		{
+			return lock_t{ m_ctrl_blck.m_mutex, std::defer_lock };
+		}
+
+		[[nodiscard]] locked_ptr_t adopt_lock_impl(lock_t lock, const call_site_t& site = call_site_t{})
+		{
+			assert(lock.owns_lock() && lock.mutex() == &m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_stats.adopt(lock, site);
+			return locked_ptr_t{ std::move(lock), &m_ctrl_blck, site };
+		}
+
+		void notify_one_impl() 
+		{
+			m_ctrl_blck.m_condition_variable.notify_one();
+		}
+
+		void notify_all_impl() 
+		{
+			m_ctrl_blck.m_condition_variable.notify_all();
+		}
+
+		[[nodiscard]] typename ctrl_blck_t::stats_t& stats_impl() const noexcept
+		{
+			return m_ctrl_blck.m_stats;
+		}
+
+
+		[[nodiscard]] auto copy_locked_datum() const
+			noexcept(std::is_nothrow_copy_constructible_v<locked_t>)->locked_t
+			requires (std::copy_constructible<locked_t>)
+		{
+			auto lock = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			return m_ctrl_blck.m_locked;
+		}
+
+		auto release_locked_datum() noexcept -> locked_t
+			requires (std::is_nothrow_move_constructible_v<locked_t>&& std::is_nothrow_default_constructible_v<locked_t>)
+		{
+			locked_t def_val;
+			auto lock = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			std::swap(m_ctrl_blck.m_locked, def_val);
+			return def_val;
+		}
+
+		auto swap_locked_datum(locked_t&& swap_me) noexcept -> locked_t
+			requires (std::is_nothrow_swappable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			std::swap(swap_me, m_ctrl_blck.m_locked);
+			return swap_me;
+		}
+
+		void assign_locked_datum(const locked_t& new_datum)
+			noexcept (std::is_nothrow_copy_assignable_v<locked_t>)
+			requires(std::is_copy_assignable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_locked = new_datum;
+		}
+
+		void assign_locked_datum(locked_t&& new_datum)
+			noexcept(std::is_nothrow_move_assignable_v<locked_t>)
+			requires(std::is_move_assignable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_locked = std::move(new_datum);
+		}
+	
+	private:
+		ctrl_blck_t m_ctrl_blck;
+	};
+
+	template <typename TLocked>
+	locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::~locked_ptr_base()
+	{
+		release_impl();
+	}
+
+	template <typename TLocked>
+	auto locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::operator=(locked_ptr_base&& other) noexcept -> locked_ptr_base&
+	{
+		if (this != &other)
+		{
+			release_impl();
+			m_release_notifier = std::move(other.m_release_notifier);
+			m_lock = std::move(other.m_lock);
+			m_ctrl_blck = std::exchange(other.m_ctrl_blck, nullptr);
+			m_hold_timer = other.m_hold_timer;
+		}
+		return *this;
+	}
+
+	template <typename TLocked>
+	void locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::release_impl() noexcept
+	{
+		const lock_release_notify notify = m_release_notifier.take();
+		if (m_lock.owns_lock())
+		{
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
+			m_lock.unlock();
+		}
+		if (m_ctrl_blck == nullptr)
+		{
+			return;
+		}
+		if (notify == lock_release_notify::one)
+		{
+			m_ctrl_blck->m_condition_variable.notify_one();
+		}
+		else if (notify == lock_release_notify::all)
+		{
+			m_ctrl_blck->m_condition_variable.notify_all();
+		}
+		m_ctrl_blck = nullptr;
+	}
+
+	template <typename TLocked>
+	auto locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::scoped_unlock_impl(const call_site_t& site) -> scoped_unlock_t
+	{
+		return scoped_unlock_t{ *this, site };
+	}
+
+	template <typename TLocked>
+	auto locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::locked_value() const -> std::add_lvalue_reference_t<typename locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::locked_t>
+	{
+		assert(is_locked_impl() && m_ctrl_blck != nullptr);
+		return m_ctrl_blck->m_locked;
+	}
+
+	template<typename TLocked, concepts::mutex TMutex>
+	class locked_ptr_base<TLocked, TMutex, concepts::mutex_level::basic>
+	{
+	public:
+		using release_notifier_t = release_notifier_for_t<TLocked, TMutex, concepts::mutex_level::basic>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::basic>;
+		friend class scoped_unlock<TLocked, TMutex, concepts::mutex_level::basic>;
+		using locked_t = std::remove_reference_t<TLocked>;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using locked_ptr_t = std::add_pointer_t<lock_t>;
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::basic>;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::basic>;
+		friend ctrl_blck_t;
+		friend synchro_vault_t;
+		using ctrl_blck_ptr_t = std::add_pointer_t<ctrl_blck_t>;
+		using stats_t = typename ctrl_blck_t::stats_t;
+		using hold_timer_t = typename stats_t::hold_timer_t;
+		static constexpr concepts::time_type condition_variable_time = ctrl_blck_t::condition_variable_time;
+
+		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ctrl_blck_ptr_t>;
+		~locked_ptr_base();
+		locked_ptr_base(const locked_ptr_base& other) = delete;
+		locked_ptr_base(locked_ptr_base&& other) noexcept
+			: m_release_notifier{ std::move(other.m_release_notifier) },
+			m_lock{ std::move(other.m_lock) }, m_ctrl_blck{ std::exchange(other.m_ctrl_blck, nullptr) },
+			m_hold_timer{ other.m_hold_timer } {}
+		locked_ptr_base& operator=(const locked_ptr_base& other) = delete;
+		locked_ptr_base& operator=(locked_ptr_base&& other) noexcept;
+
+	protected:
+
+		lock_release_notify lock_release_setting() const noexcept
+		{
+			return m_release_notifier.setting();
+		}
+
+		void release_impl() noexcept;
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock_impl(const call_site_t& site);
+
+		void notify_one_impl()
+		{
+			m_ctrl_blck->m_condition_variable.notify_one();
+		}
+
+		void notify_all_impl()
+		{
+			m_ctrl_blck->m_condition_variable.notify_all();
+		}
+
+		void set_cv_release_notification(lock_release_notify lrn)
+			requires (release_notifier_t::policy == release_notify_policy::runtime)
+		{
+			assert(lrn >= lock_release_notify::none && lrn <= lock_release_notify::all);
+			m_release_notifier.set(lrn);
+		}
+
+		template<concepts::duration Duration>
+		void wait_for_impl(const Duration& d)
+		{
+			assert(is_locked_impl());
+			static_assert(
+				(concepts::detail::std_duration<Duration> ||
+					concepts::detail::boost_duration<Duration>)
+				&&
+				!(concepts::detail::std_duration<Duration> &&
+					concepts::detail::boost_duration<Duration>));
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_for(m_lock, d);
+		}
+
+		template<concepts::duration Duration, std::predicate Predicate>
+		void wait_for_impl(const Duration& d, Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_for(m_lock, d, p);
+		}
+
+		template<concepts::time_point TimePoint>
+		void wait_until_impl(const TimePoint& tp)
+		{
+			assert(is_locked_impl());
+			static_assert(
+				(concepts::detail::boost_time_point<TimePoint> ||
+					concepts::detail::std_time_point<TimePoint>)
+				&&
+				!(concepts::detail::boost_time_point<TimePoint> &&
+					concepts::detail::std_time_point<TimePoint>));
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp);
+		}
+
+		template<concepts::time_point TimePoint, std::predicate Predicate>
+		void wait_until_impl(const TimePoint& tp, Predicate p)
+		{
+			assert(is_locked_impl());
+			static_assert(
+				(concepts::detail::boost_time_point<TimePoint> ||
+					concepts::detail::std_time_point<TimePoint>)
+				&&
+				!(concepts::detail::boost_time_point<TimePoint> &&
+					concepts::detail::std_time_point<TimePoint>));
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp, p);
+		}
+
+		void wait_impl()
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait(m_lock);
+		}
+
+		template<std::predicate Predicate>
+		void wait_impl(Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				bool woken = false;
+				m_ctrl_blck->m_condition_variable.wait(m_lock, m_ctrl_blck->m_stats.count_wakeups(p, woken));
+			}
+			else
+			{
+				m_ctrl_blck->m_condition_variable.wait(m_lock, p);
+			}
+		}
+
+		// Present only when the condition variable supports coroutine waits (async_condition).
+		template<std::predicate Predicate, typename... TExecutor>
+			requires (async_waitable_condition<condition_variable_t, lock_t, Predicate, TExecutor...>)
+		[[nodiscard]] auto wait_async_impl(Predicate p, TExecutor&... executor)
+		{
+			assert(is_locked_impl());
+			return m_ctrl_blck->m_condition_variable.wait_async(m_lock, std::move(p), executor...);
+		}
+
+		[[nodiscard]] std::add_lvalue_reference_t<locked_t> locked_value() const;
+
+
+		[[nodiscard]] bool is_empty_impl() const noexcept
+		{
+			return get_mutex_impl() == nullptr && m_ctrl_blck == nullptr;
+		}
+
+		void lock_impl(unlocker_data_t unlocker_data, const call_site_t& site)
+		{
+			assert(!is_locked_impl());
+			m_lock = std::move(unlocker_data.first);
+			m_ctrl_blck = unlocker_data.second;
+			assert(m_ctrl_blck != nullptr && m_lock.mutex() != nullptr && !m_lock.owns_lock());
+			if constexpr (stats_t::enabled)
+			{
+				m_ctrl_blck->m_stats.lock(m_lock, site);
+				m_hold_timer.start();
+			}
+			else
+			{
+				m_lock.lock();
+			}
+			assert(is_locked_impl());
+		}
+
+		unlocker_data_t unlock_impl()
+		{
+			assert(is_locked_impl());
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
+			unlocker_data_t ret = std::make_pair(std::move(m_lock), m_ctrl_blck);
+			m_ctrl_blck = nullptr;
+			ret.first.unlock();
+			assert(ret.second != nullptr && !is_locked_impl() && is_empty_impl());
+			return ret;
+		}
+
+		[[nodiscard]] bool is_locked_impl() const noexcept
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			return m_lock.owns_lock();
+		}
+
+		[[nodiscard]] mutex_t* get_mutex_impl() const noexcept
+		{
+			return m_lock.mutex();
+		}
+
+		explicit locked_ptr_base(std::unique_lock<mutex_t> lock, ctrl_blck_ptr_t locked, const call_site_t& site = call_site_t{}) : m_lock{ std::move(lock) }, m_ctrl_blck{ locked }
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			if constexpr (stats_t::enabled)
+			{
+				if (m_lock.owns_lock())
+				{
+					m_hold_timer.start(site);
+				}
+			}
+		}
+		locked_ptr_base() = default;
+	private:
+
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS release_notifier_t m_release_notifier;
+		lock_t m_lock;
+		ctrl_blck_ptr_t m_ctrl_blck{nullptr};
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS hold_timer_t m_hold_timer;
+	};
+
+
+
+	template <typename TLocked, concepts::mutex TMutex>
+	class scoped_unlock<TLocked, TMutex, concepts::mutex_level::basic>
+	{
+	public:
+		using locked_ptr_base_t = locked_ptr_base<TLocked, TMutex, concepts::mutex_level::basic>;
+		using unlocker_data_t = typename locked_ptr_base_t::unlocker_data_t;
+		using call_site_t = typename locked_ptr_base_t::call_site_t;
+		scoped_unlock& operator=(scoped_unlock&& other) noexcept = delete;
+		scoped_unlock& operator=(const scoped_unlock& other) = delete;
+		scoped_unlock() = delete;
+		scoped_unlock(scoped_unlock&& other) noexcept = delete;
+		scoped_unlock(const scoped_unlock& other) = delete;
+		explicit scoped_unlock(locked_ptr_base_t& locked_ptr, const call_site_t& site) : m_unlocker_data{}, m_ptr(&locked_ptr), m_site{ site }
+		{
+			assert(locked_ptr.is_locked_impl());
+			m_unlocker_data = locked_ptr.unlock_impl();
+			assert(!m_ptr->is_locked_impl() && m_unlocker_data.second != nullptr);
+		}
+		~scoped_unlock()
+		{
+			assert(static_cast<bool>(m_ptr) && !m_ptr->is_locked_impl());
+			m_ptr->lock_impl(std::move(m_unlocker_data), m_site);
+			assert(m_ptr->is_locked_impl());
+		}
+
+	private:
+		unlocker_data_t m_unlocker_data;
+		locked_ptr_base_t* m_ptr;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS call_site_t m_site;
+	};
+
+	template<typename TLocked, concepts::mutex TMutex>
+	class synchro_vault_base<TLocked, TMutex, concepts::mutex_level::basic>
+	{
+	protected:
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::basic>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::basic>;
+		using locked_t = typename ctrl_blck_t::locked_datum_t;
+		using mutex_t = typename ctrl_blck_t::mutex_t;
+		using lock_t = typename ctrl_blck_t::lock_t;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using ptr_to_locked = typename ctrl_blck_t::ptr_to_locked_datum;
+		using unlocker_data_t = typename ctrl_blck_t::unlocker_data_t;
+		using vault_owner_t = typename ctrl_blck_t::vault_owner_t;
+		static_assert(std::is_same_v<synchro_vault_base<TLocked, TMutex, concepts::mutex_level::basic>, vault_owner_t>);
+		using locked_ptr_t = typename ctrl_blck_t::locked_ptr_t;
+		friend ctrl_blck_t;
+		friend scoped_unlock_t;		
+
+		synchro_vault_base() noexcept(std::is_nothrow_default_constructible_v<locked_t>)
+			requires (std::is_default_constructible_v<locked_t>) : m_ctrl_blck{} {}
+		synchro_vault_base(const locked_t& locked_datum) noexcept(std::is_nothrow_copy_constructible_v<locked_t>)
+			requires (std::copy_constructible<locked_t>) : m_ctrl_blck{ locked_datum } {}
+		synchro_vault_base(locked_t&& locked_datum) noexcept(std::is_nothrow_move_constructible_v<locked_t>)
+			requires (std::move_constructible<locked_t>) : m_ctrl_blck{ std::move(locked_datum) } {}
+		template<typename...TArgs>
+		requires (std::constructible_from<locked_t, TArgs...>)
+			synchro_vault_base(TArgs&&... args) noexcept(cjm::concepts::nothrow_constructible_from<locked_t,
+				TArgs...>) : m_ctrl_blck{ std::forward<TArgs>(args)... } {}
+
+		[[nodiscard]] locked_ptr_t lock_impl(const call_site_t& site)
+		{
+			return locked_ptr_t{ acquire_lock<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex, site), &m_ctrl_blck, site };
+		}
+
+		[[nodiscard]] lock_t defer_lock_impl() const
+		{
+			return lock_t{ m_ctrl_blck.m_mutex, std::defer_lock };
+		}
+
+		[[nodiscard]] locked_ptr_t adopt_lock_impl(lock_t lock, const call_site_t& site = call_site_t{})
+		{
+			assert(lock.owns_lock() && lock.mutex() == &m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_stats.adopt(lock, site);
+			return locked_ptr_t{ std::move(lock), &m_ctrl_blck, site };
+		}
+
+		void notify_one_impl() 
+		{
+			m_ctrl_blck.m_condition_variable.notify_one();
+		}
+
+		void notify_all_impl() 
+		{
+			m_ctrl_blck.m_condition_variable.notify_all();
+		}
+
+		[[nodiscard]] typename ctrl_blck_t::stats_t& stats_impl() const noexcept
+		{
+			return m_ctrl_blck.m_stats;
+		}
+
+
+		[[nodiscard]] auto copy_locked_datum() const
+			noexcept(std::is_nothrow_copy_constructible_v<locked_t>)->locked_t
+			requires (std::copy_constructible<locked_t>)
+		{
+			auto lock = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			return m_ctrl_blck.m_locked;
+		}
+
+		auto release_locked_datum() noexcept -> locked_t
+			requires (std::is_nothrow_move_constructible_v<locked_t>&& std::is_nothrow_default_constructible_v<locked_t>)
+		{
+			locked_t def_val;
+			auto lock = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			std::swap(m_ctrl_blck.m_locked, def_val);
+			return def_val;
+		}
+
+		auto swap_locked_datum(locked_t&& swap_me) noexcept -> locked_t
+			requires (std::is_nothrow_swappable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			std::swap(swap_me, m_ctrl_blck.m_locked);
+			return swap_me;
+		}
+
+		void assign_locked_datum(const locked_t& new_datum)
+			noexcept (std::is_nothrow_copy_assignable_v<locked_t>)
+			requires(std::is_copy_assignable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_locked = new_datum;
+		}
+
+		void assign_locked_datum(locked_t&& new_datum)
+			noexcept(std::is_nothrow_move_assignable_v<locked_t>)
+			requires(std::is_move_assignable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_locked = std::move(new_datum);
+		}
+	
+	private:
+		ctrl_blck_t m_ctrl_blck;
+	};
+
+	template <typename TLocked, concepts::mutex TMutex>
+	locked_ptr_base<TLocked, TMutex, concepts::mutex_level::basic>::~locked_ptr_base()
+	{
+		release_impl();
+	}
+
+	template <typename TLocked, concepts::mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::basic>::operator=(locked_ptr_base&& other) noexcept -> locked_ptr_base&
+	{
+		if (this != &other)
+		{
+			release_impl();
+			m_release_notifier = std::move(other.m_release_notifier);
+			m_lock = std::move(other.m_lock);
+			m_ctrl_blck = std::exchange(other.m_ctrl_blck, nullptr);
+			m_hold_timer = other.m_hold_timer;
+		}
+		return *this;
+	}
+
+	template <typename TLocked, concepts::mutex TMutex>
+	void locked_ptr_base<TLocked, TMutex, concepts::mutex_level::basic>::release_impl() noexcept
+	{
+		const lock_release_notify notify = m_release_notifier.take();
+		if (m_lock.owns_lock())
+		{
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
+			m_lock.unlock();
+		}
+		if (m_ctrl_blck == nullptr)
+		{
+			return;
+		}
+		if (notify == lock_release_notify::one)
+		{
+			m_ctrl_blck->m_condition_variable.notify_one();
+		}
+		else if (notify == lock_release_notify::all)
+		{
+			m_ctrl_blck->m_condition_variable.notify_all();
+		}
+		m_ctrl_blck = nullptr;
+	}
+
+	template <typename TLocked, concepts::mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::basic>::scoped_unlock_impl(const call_site_t& site) -> scoped_unlock_t
+	{
+		return scoped_unlock_t{ *this, site };
+	}
+
+	template <typename TLocked, concepts::mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::basic>::locked_value() const -> std::add_lvalue_reference_t<typename locked_ptr_base<TLocked, TMutex, concepts::mutex_level::basic>::locked_t>
+	{
+		assert(is_locked_impl() && m_ctrl_blck != nullptr);
+		return m_ctrl_blck->m_locked;
+	}
+
+	template<typename TLocked, concepts::shared_mutex TMutex>
+	class ctrl_block<TLocked, TMutex, concepts::mutex_level::shared>
+	{
+	protected:
+		static constexpr concepts::mutex_level level = concepts::mutex_level::shared;
+
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::shared>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::shared>;
+		using locked_datum_t = std::remove_reference_t<TLocked>;
+		using const_locked_datum_t = std::add_const_t<locked_datum_t>;
+		using locked_datum_ref_t = std::add_lvalue_reference_t<locked_datum_t>;
+		using const_locked_datum_ref_t = std::add_lvalue_reference_t<const_locked_datum_t>;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using shared_lock_t = std::shared_lock<TMutex>;
+		using condition_variable_t = vault_condition_t<TLocked, TMutex, level, condition_variable_for_t<TMutex, level>>;
+		using stats_t = vault_stats_for_t<TLocked, TMutex, level>;
+		using call_site_t = typename stats_t::site_t;
+		using layout_t = ctrl_block_layout<TLocked, TMutex, level>;
+		using ptr_to_locked_datum = std::add_pointer_t<locked_datum_t>;
+		using ptr_to_const_locked_datum = std::add_pointer_t<const_locked_datum_t>;
+		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ptr_to_locked_datum>;
+		using vault_owner_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::shared>;
+		using locked_ptr_t = locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>;
+		using shared_locked_ptr_t = shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>;
+		static constexpr concepts::time_type condition_variable_time = concepts::time_type::std;
+		friend locked_ptr_t;
+		friend shared_locked_ptr_t;
+		friend scoped_unlock_t;
+		friend synchro_vault_t;
+
+	public:
+		ctrl_block(const ctrl_block& cb) = delete;
+		ctrl_block(ctrl_block&& cb) noexcept = delete;
+		ctrl_block& operator=(const ctrl_block& cb) = delete;
+		ctrl_block& operator=(ctrl_block&& cb) noexcept = delete;
+		~ctrl_block() = default;
+	protected:
+		ctrl_block() noexcept(std::is_nothrow_default_constructible_v<locked_datum_t>)
+			requires (std::is_default_constructible_v<locked_datum_t>)
+			: m_mutex{}, m_condition_variable{}, m_locked{} {}
+		explicit ctrl_block(const locked_datum_t& locked)
+			noexcept(std::is_nothrow_copy_constructible_v<locked_datum_t>)
+			requires std::copy_constructible<locked_datum_t> : m_mutex{}, m_condition_variable{}, m_locked{ locked } {}
+
+		explicit ctrl_block(locked_datum_t&& locked)
+			noexcept(std::is_nothrow_move_constructible_v<locked_datum_t>)
+			requires (std::move_constructible<locked_datum_t>) : m_mutex{}, m_condition_variable{}, m_locked{ std::move(locked) } {}
+		template<typename...TArgs>
+			requires (std::constructible_from<locked_datum_t, TArgs...>)
+		ctrl_block(TArgs&&... args)
+			noexcept(cjm::concepts::nothrow_constructible_from<locked_datum_t,
+				TArgs...>)
+			: m_mutex{}, m_condition_variable{},
+			m_locked{ std::forward<TArgs>(args)... } {}
+
+		alignas(layout_t::template lock_align<mutex_t>) mutable mutex_t m_mutex;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS alignas(layout_t::template cold_align<condition_variable_t>)
+			mutable condition_variable_t m_condition_variable;
+		alignas(layout_t::template hot_align<locked_datum_t>) locked_datum_t m_locked;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS mutable stats_t m_stats;
+	};
+
+	template<typename TLocked, concepts::shared_mutex TMutex>
+	class locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>
+	{
+	public:
+		using release_notifier_t = release_notifier_for_t<TLocked, TMutex, concepts::mutex_level::shared>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::shared>;
+		friend scoped_unlock_t;
+		using locked_t = std::remove_reference_t<TLocked>;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::shared>;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::shared>;
+		friend ctrl_blck_t;
+		friend synchro_vault_t;
+		using ctrl_blck_ptr_t = std::add_pointer_t<ctrl_blck_t>;
+		using stats_t = typename ctrl_blck_t::stats_t;
+		using hold_timer_t = typename stats_t::hold_timer_t;
+		static constexpr concepts::time_type condition_variable_time = ctrl_blck_t::condition_variable_time;
+
+		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ctrl_blck_ptr_t>;
+		~locked_ptr_base();
+		locked_ptr_base(const locked_ptr_base& other) = delete;
+		locked_ptr_base(locked_ptr_base&& other) noexcept
+			: m_release_notifier{ std::move(other.m_release_notifier) },
+			m_lock{ std::move(other.m_lock) }, m_ctrl_blck{ std::exchange(other.m_ctrl_blck, nullptr) },
+			m_hold_timer{ other.m_hold_timer } {}
+		locked_ptr_base& operator=(const locked_ptr_base& other) = delete;
+		locked_ptr_base& operator=(locked_ptr_base&& other) noexcept;
+
+	protected:
+
+		lock_release_notify lock_release_setting() const noexcept
+		{
+			return m_release_notifier.setting();
+		}
+
+		void release_impl() noexcept;
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock_impl(const call_site_t& site);
+
+		void notify_one_impl()
+		{
+			m_ctrl_blck->m_condition_variable.notify_one();
+		}
+
+		void notify_all_impl()
+		{
+			m_ctrl_blck->m_condition_variable.notify_all();
+		}
+
+		void set_cv_release_notification(lock_release_notify lrn)
+			requires (release_notifier_t::policy == release_notify_policy::runtime)
+		{
+			assert(lrn >= lock_release_notify::none && lrn <= lock_release_notify::all);
+			m_release_notifier.set(lrn);
+		}
+
+		template<concepts::duration Duration>
+		void wait_for_impl(const Duration& d)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_for(m_lock, d);
+		}
+
+		template<concepts::duration Duration, std::predicate Predicate>
+		void wait_for_impl(const Duration& d, Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_for(m_lock, d, p);
+		}
+
+		template<concepts::time_point TimePoint>
+		void wait_until_impl(const TimePoint& tp)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp);
+		}
+
+		template<concepts::time_point TimePoint, std::predicate Predicate>
+		void wait_until_impl(const TimePoint& tp, Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp, p);
+		}
+
+		void wait_impl()
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait(m_lock);
+		}
+
+		template<std::predicate Predicate>
+		void wait_impl(Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				bool woken = false;
+				m_ctrl_blck->m_condition_variable.wait(m_lock, m_ctrl_blck->m_stats.count_wakeups(p, woken));
+			}
+			else
+			{
+				m_ctrl_blck->m_condition_variable.wait(m_lock, p);
+			}
+		}
+
+		// Present only when the condition variable supports coroutine waits (async_condition).
+		template<std::predicate Predicate, typename... TExecutor>
+			requires (async_waitable_condition<condition_variable_t, lock_t, Predicate, TExecutor...>)
+		[[nodiscard]] auto wait_async_impl(Predicate p, TExecutor&... executor)
+		{
+			assert(is_locked_impl());
+			return m_ctrl_blck->m_condition_variable.wait_async(m_lock, std::move(p), executor...);
+		}
+
+		[[nodiscard]] std::add_lvalue_reference_t<locked_t> locked_value() const;
+
+		[[nodiscard]] bool is_empty_impl() const noexcept
+		{
+			return get_mutex_impl() == nullptr && m_ctrl_blck == nullptr;
+		}
+
+		void lock_impl(unlocker_data_t unlocker_data, const call_site_t& site)
+		{
+			assert(!is_locked_impl());
+			m_lock = std::move(unlocker_data.first);
+			m_ctrl_blck = unlocker_data.second;
+			assert(m_ctrl_blck != nullptr && m_lock.mutex() != nullptr && !m_lock.owns_lock());
+			if constexpr (stats_t::enabled)
+			{
+				m_ctrl_blck->m_stats.lock(m_lock, site);
+				m_hold_timer.start();
+			}
+			else
+			{
+				m_lock.lock();
+			}
+			assert(is_locked_impl());
+		}
+
+		unlocker_data_t unlock_impl()
+		{
+			assert(is_locked_impl());
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
+			unlocker_data_t ret = std::make_pair(std::move(m_lock), m_ctrl_blck);
+			m_ctrl_blck = nullptr;
+			ret.first.unlock();
+			assert(ret.second != nullptr && !is_locked_impl() && is_empty_impl());
+			return ret;
+		}
+
+		[[nodiscard]] bool is_locked_impl() const noexcept
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			return m_lock.owns_lock();
+		}
+
+		[[nodiscard]] mutex_t* get_mutex_impl() const noexcept
+		{
+			return m_lock.mutex();
+		}
+
+		explicit locked_ptr_base(std::unique_lock<mutex_t> lock, ctrl_blck_ptr_t locked, const call_site_t& site = call_site_t{}) : m_lock{ std::move(lock) }, m_ctrl_blck{ locked }
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			if constexpr (stats_t::enabled)
+			{
+				if (m_lock.owns_lock())
+				{
+					m_hold_timer.start(site);
+				}
+			}
+		}
+		locked_ptr_base() = default;
+	private:
+
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS release_notifier_t m_release_notifier;
+		lock_t m_lock;
+		ctrl_blck_ptr_t m_ctrl_blck{nullptr};
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS hold_timer_t m_hold_timer;
+	};
+
+	template<typename TLocked, concepts::shared_mutex TMutex>
+	class shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>
+	{
+	public:
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::shared>;
+		friend scoped_unlock_t;
+		using locked_t = std::remove_reference_t<TLocked>;
+		using const_locked_t = std::add_const_t<locked_t>;
+		using mutex_t = TMutex;
+		using shared_lock_t = std::shared_lock<TMutex>;
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::shared>;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::shared>;
+		friend ctrl_blck_t;
+		friend synchro_vault_t;
+		using ctrl_blck_ptr_t = std::add_pointer_t<std::add_const_t<ctrl_blck_t>>;
+		static constexpr concepts::time_type condition_variable_time = ctrl_blck_t::condition_variable_time;
+
+		using unlocker_data_t = std::pair<std::shared_lock<mutex_t>, ctrl_blck_ptr_t>;
+		~shared_locked_ptr_base() = default;
+		shared_locked_ptr_base(const shared_locked_ptr_base& other) = delete;
+		shared_locked_ptr_base(shared_locked_ptr_base&& other) noexcept
+			: m_lock{ std::move(other.m_lock) }, m_ctrl_blck{ std::exchange(other.m_ctrl_blck, nullptr) } {}
+		shared_locked_ptr_base& operator=(const shared_locked_ptr_base& other) = delete;
+		shared_locked_ptr_base& operator=(shared_locked_ptr_base&& other) noexcept
+		{
+			if (this != &other)
+			{
+				m_lock = std::move(other.m_lock);
+				m_ctrl_blck = std::exchange(other.m_ctrl_blck, nullptr);
+			}
+			return *this;
+		}
+
+	protected:
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock_impl(const call_site_t& site);
+
+		template<concepts::duration Duration, std::predicate Predicate>
+		bool wait_for_impl(const Duration& d, Predicate p)
+		{
+			assert(is_locked_impl());
+			return m_ctrl_blck->m_condition_variable.wait_for(m_lock, d, p);
+		}
+
+		template<concepts::time_point TimePoint, std::predicate Predicate>
+		bool wait_until_impl(const TimePoint& tp, Predicate p)
+		{
+			assert(is_locked_impl());
+			return m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp, p);
+		}
+
+		template<std::predicate Predicate>
+		void wait_impl(Predicate p)
+		{
+			assert(is_locked_impl());
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				bool woken = false;
+				m_ctrl_blck->m_condition_variable.wait(m_lock, m_ctrl_blck->m_stats.count_wakeups(p, woken));
+			}
+			else
+			{
+				m_ctrl_blck->m_condition_variable.wait(m_lock, p);
+			}
+		}
+
+		// Present only when the condition variable supports coroutine waits (async_condition).
+		template<std::predicate Predicate, typename... TExecutor>
+			requires (async_waitable_condition<condition_variable_t, shared_lock_t, Predicate, TExecutor...>)
+		[[nodiscard]] auto wait_async_impl(Predicate p, TExecutor&... executor)
+		{
+			assert(is_locked_impl());
+			return m_ctrl_blck->m_condition_variable.wait_async(m_lock, std::move(p), executor...);
+		}
+
+		[[nodiscard]] std::add_lvalue_reference_t<const_locked_t> locked_value() const
+		{
+			assert(is_locked_impl() && m_ctrl_blck != nullptr);
+			return m_ctrl_blck->m_locked;
+		}
+
+		[[nodiscard]] bool is_empty_impl() const noexcept
+		{
+			return get_mutex_impl() == nullptr && m_ctrl_blck == nullptr;
+		}
+
+		void lock_impl(unlocker_data_t unlocker_data, const call_site_t& site)
+		{
+			assert(!is_locked_impl());
+			m_lock = std::move(unlocker_data.first);
+			m_ctrl_blck = unlocker_data.second;
+			assert(m_ctrl_blck != nullptr && m_lock.mutex() != nullptr && !m_lock.owns_lock());
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				m_ctrl_blck->m_stats.lock(m_lock, site);
+			}
+			else
+			{
+				m_lock.lock();
+			}
+			assert(is_locked_impl());
+		}
+
+		unlocker_data_t unlock_impl()
+		{
+			assert(is_locked_impl());
+			unlocker_data_t ret = std::make_pair(std::move(m_lock), m_ctrl_blck);
+			m_ctrl_blck = nullptr;
+			ret.first.unlock();
+			assert(ret.second != nullptr && !is_locked_impl() && is_empty_impl());
+			return ret;
+		}
+
+		[[nodiscard]] bool is_locked_impl() const noexcept
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			return m_lock.owns_lock();
+		}
+
+		[[nodiscard]] mutex_t* get_mutex_impl() const noexcept
+		{
+			return m_lock.mutex();
+		}
+
+		explicit shared_locked_ptr_base(std::shared_lock<mutex_t> lock, ctrl_blck_ptr_t locked) : m_lock{ std::move(lock) }, m_ctrl_blck{ locked }
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+		}
+		shared_locked_ptr_base() = default;
+	private:
+		shared_lock_t m_lock;
+		ctrl_blck_ptr_t m_ctrl_blck{nullptr};
+	};
+
+	template <typename TLocked, concepts::shared_mutex TMutex>
+	class scoped_unlock<TLocked, TMutex, concepts::mutex_level::shared>
+	{
+	public:
+		using locked_ptr_base_t = locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>;
+		using shared_locked_ptr_base_t = shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>;
+		using unlocker_data_t = typename locked_ptr_base_t::unlocker_data_t;
+		using call_site_t = typename locked_ptr_base_t::call_site_t;
+		using shared_unlocker_data_t = typename shared_locked_ptr_base_t::unlocker_data_t;
+		scoped_unlock& operator=(scoped_unlock&& other) noexcept = delete;
+		scoped_unlock& operator=(const scoped_unlock& other) = delete;
+		scoped_unlock() = delete;
+		scoped_unlock(scoped_unlock&& other) noexcept = delete;
+		scoped_unlock(const scoped_unlock& other) = delete;
+		explicit scoped_unlock(locked_ptr_base_t& locked_ptr, const call_site_t& site)
+			: m_unlocker_data{}, m_shared_unlocker_data{}, m_ptr(&locked_ptr), m_shared_ptr{nullptr}, m_site{ site }
+		{
+			assert(locked_ptr.is_locked_impl());
+			m_unlocker_data = locked_ptr.unlock_impl();
+			assert(!m_ptr->is_locked_impl() && m_unlocker_data.second != nullptr);
+		}
+		explicit scoped_unlock(shared_locked_ptr_base_t& shared_locked_ptr, const call_site_t& site)
+			: m_unlocker_data{}, m_shared_unlocker_data{}, m_ptr{nullptr}, m_shared_ptr(&shared_locked_ptr), m_site{ site }
+		{
+			assert(shared_locked_ptr.is_locked_impl());
+			m_shared_unlocker_data = shared_locked_ptr.unlock_impl();
+			assert(!m_shared_ptr->is_locked_impl() && m_shared_unlocker_data.second != nullptr);
+		}
+		~scoped_unlock()
+		{
+			assert((m_ptr == nullptr) != (m_shared_ptr == nullptr));
+			if (m_ptr != nullptr)
+			{
+				assert(!m_ptr->is_locked_impl());
+				m_ptr->lock_impl(std::move(m_unlocker_data), m_site);
+				assert(m_ptr->is_locked_impl());
+			}
+			else
+			{
+				assert(!m_shared_ptr->is_locked_impl());
+				m_shared_ptr->lock_impl(std::move(m_shared_unlocker_data), m_site);
+				assert(m_shared_ptr->is_locked_impl());
+			}
+		}
+
+	private:
+		unlocker_data_t m_unlocker_data;
+		shared_unlocker_data_t m_shared_unlocker_data;
+		locked_ptr_base_t* m_ptr;
+		shared_locked_ptr_base_t* m_shared_ptr;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS call_site_t m_site;
+	};
+
+	template<typename TLocked, concepts::shared_mutex TMutex>
+	class synchro_vault_base<TLocked, TMutex, concepts::mutex_level::shared>
+	{
+	protected:
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::shared>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::shared>;
+		using locked_t = typename ctrl_blck_t::locked_datum_t;
+		using mutex_t = typename ctrl_blck_t::mutex_t;
+		using lock_t = typename ctrl_blck_t::lock_t;
+		using shared_lock_t = typename ctrl_blck_t::shared_lock_t;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using ptr_to_locked = typename ctrl_blck_t::ptr_to_locked_datum;
+		using unlocker_data_t = typename ctrl_blck_t::unlocker_data_t;
+		using vault_owner_t = typename ctrl_blck_t::vault_owner_t;
+		static_assert(std::is_same_v<synchro_vault_base<TLocked, TMutex, concepts::mutex_level::shared>, vault_owner_t>);
+		using locked_ptr_t = typename ctrl_blck_t::locked_ptr_t;
+		using shared_locked_ptr_t = typename ctrl_blck_t::shared_locked_ptr_t;
+		friend ctrl_blck_t;
+		friend scoped_unlock_t;
+
+		synchro_vault_base() noexcept(std::is_nothrow_default_constructible_v<locked_t>)
+			requires (std::is_default_constructible_v<locked_t>) : m_ctrl_blck{} {}
+		synchro_vault_base(const locked_t& locked_datum) noexcept(std::is_nothrow_copy_constructible_v<locked_t>)
+			requires (std::copy_constructible<locked_t>) : m_ctrl_blck{ locked_datum } {}
+		synchro_vault_base(locked_t&& locked_datum) noexcept(std::is_nothrow_move_constructible_v<locked_t>)
+			requires (std::move_constructible<locked_t>) : m_ctrl_blck{ std::move(locked_datum) } {}
+		template<typename...TArgs>
+		requires (std::constructible_from<locked_t, TArgs...>)
+			synchro_vault_base(TArgs&&... args) noexcept(cjm::concepts::nothrow_constructible_from<locked_t,
+				TArgs...>) : m_ctrl_blck{ std::forward<TArgs>(args)... } {}
+
+		[[nodiscard]] locked_ptr_t lock_impl(const call_site_t& site)
+		{
+			return locked_ptr_t{ acquire_lock<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex, site), &m_ctrl_blck, site };
+		}
+
+		[[nodiscard]] lock_t defer_lock_impl() const
+		{
+			return lock_t{ m_ctrl_blck.m_mutex, std::defer_lock };
+		}
+
+		[[nodiscard]] locked_ptr_t adopt_lock_impl(lock_t lock, const call_site_t& site = call_site_t{})
+		{
+			assert(lock.owns_lock() && lock.mutex() == &m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_stats.adopt(lock, site);
+			return locked_ptr_t{ std::move(lock), &m_ctrl_blck, site };
+		}
+
+		[[nodiscard]] shared_locked_ptr_t lock_shared_impl(const call_site_t& site) const
+		{
+			return shared_locked_ptr_t{ acquire_lock<shared_lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex, site), &m_ctrl_blck };
+		}
+
+		[[nodiscard]] shared_lock_t defer_lock_shared_impl() const
+		{
+			return shared_lock_t{ m_ctrl_blck.m_mutex, std::defer_lock };
+		}
+
+		[[nodiscard]] shared_locked_ptr_t adopt_lock_impl(shared_lock_t lock, const call_site_t& site = call_site_t{}) const
+		{
+			assert(lock.owns_lock() && lock.mutex() == &m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_stats.adopt(lock, site);
+			return shared_locked_ptr_t{ std::move(lock), &m_ctrl_blck };
+		}
+
+		void notify_one_impl()
+		{
+			m_ctrl_blck.m_condition_variable.notify_one();
+		}
+
+		void notify_all_impl()
+		{
+			m_ctrl_blck.m_condition_variable.notify_all();
+		}
+
+		[[nodiscard]] typename ctrl_blck_t::stats_t& stats_impl() const noexcept
+		{
+			return m_ctrl_blck.m_stats;
+		}
+
+		[[nodiscard]] auto copy_locked_datum() const
+			noexcept(std::is_nothrow_copy_constructible_v<locked_t>)->locked_t
+			requires (std::copy_constructible<locked_t>)
+		{
+			auto lock = scoped_acquire<shared_lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			return m_ctrl_blck.m_locked;
+		}
+
+		auto release_locked_datum() noexcept -> locked_t
+			requires (std::is_nothrow_move_constructible_v<locked_t>&& std::is_nothrow_default_constructible_v<locked_t>)
+		{
+			locked_t def_val;
+			auto lock = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			std::swap(m_ctrl_blck.m_locked, def_val);
+			return def_val;
+		}
+
+		auto swap_locked_datum(locked_t&& swap_me) noexcept -> locked_t
+			requires (std::is_nothrow_swappable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			std::swap(swap_me, m_ctrl_blck.m_locked);
+			return swap_me;
+		}
+
+		void assign_locked_datum(const locked_t& new_datum)
+			noexcept (std::is_nothrow_copy_assignable_v<locked_t>)
+			requires(std::is_copy_assignable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_locked = new_datum;
+		}
+
+		void assign_locked_datum(locked_t&& new_datum)
+			noexcept(std::is_nothrow_move_assignable_v<locked_t>)
+			requires(std::is_move_assignable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_locked = std::move(new_datum);
+		}
+
+	private:
+		ctrl_blck_t m_ctrl_blck;
+	};
+
+	template <typename TLocked, concepts::shared_mutex TMutex>
+	locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>::~locked_ptr_base()
+	{
+		release_impl();
+	}
+
+	template <typename TLocked, concepts::shared_mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>::operator=(locked_ptr_base&& other) noexcept -> locked_ptr_base&
+	{
+		if (this != &other)
+		{
+			release_impl();
+			m_release_notifier = std::move(other.m_release_notifier);
+			m_lock = std::move(other.m_lock);
+			m_ctrl_blck = std::exchange(other.m_ctrl_blck, nullptr);
+			m_hold_timer = other.m_hold_timer;
+		}
+		return *this;
+	}
+
+	template <typename TLocked, concepts::shared_mutex TMutex>
+	void locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>::release_impl() noexcept
+	{
+		const lock_release_notify notify = m_release_notifier.take();
+		if (m_lock.owns_lock())
+		{
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
+			m_lock.unlock();
+		}
+		if (m_ctrl_blck == nullptr)
+		{
+			return;
+		}
+		if (notify == lock_release_notify::one)
+		{
+			m_ctrl_blck->m_condition_variable.notify_one();
+		}
+		else if (notify == lock_release_notify::all)
+		{
+			m_ctrl_blck->m_condition_variable.notify_all();
+		}
+		m_ctrl_blck = nullptr;
+	}
+
+	template <typename TLocked, concepts::shared_mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>::scoped_unlock_impl(const call_site_t& site) -> scoped_unlock_t
+	{
+		return scoped_unlock_t{ *this, site };
+	}
+
+	template <typename TLocked, concepts::shared_mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>::locked_value() const -> std::add_lvalue_reference_t<typename locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>::locked_t>
+	{
+		assert(is_locked_impl() && m_ctrl_blck != nullptr);
+		return m_ctrl_blck->m_locked;
+	}
+
+	template <typename TLocked, concepts::shared_mutex TMutex>
+	auto shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::shared>::scoped_unlock_impl(const call_site_t& site) -> scoped_unlock_t
+	{
+		return scoped_unlock_t{ *this, site };
+	}
+
+#ifdef CJM_SYNCHRO_USE_BOOST_FEATURE
+	template<typename TLocked, concepts::upgrade_mutex TMutex>
+	class ctrl_block<TLocked, TMutex, concepts::mutex_level::upgrade>
+	{
+	protected:
+		static constexpr concepts::mutex_level level = concepts::mutex_level::upgrade;
+
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using locked_datum_t = std::remove_reference_t<TLocked>;
+		using const_locked_datum_t = std::add_const_t<locked_datum_t>;
+		using locked_datum_ref_t = std::add_lvalue_reference_t<locked_datum_t>;
+		using const_locked_datum_ref_t = std::add_lvalue_reference_t<const_locked_datum_t>;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using shared_lock_t = std::shared_lock<TMutex>;
+		using upgrade_lock_t = boost::upgrade_lock<TMutex>;
+		using condition_variable_t = vault_condition_t<TLocked, TMutex, level, condition_variable_for_t<TMutex, level>>;
+		using stats_t = vault_stats_for_t<TLocked, TMutex, level>;
+		using call_site_t = typename stats_t::site_t;
+		using layout_t = ctrl_block_layout<TLocked, TMutex, level>;
+		using ptr_to_locked_datum = std::add_pointer_t<locked_datum_t>;
+		using ptr_to_const_locked_datum = std::add_pointer_t<const_locked_datum_t>;
+		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ptr_to_locked_datum>;
+		using vault_owner_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using locked_ptr_t = locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using shared_locked_ptr_t = shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using upgrade_locked_ptr_t = upgrade_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		static constexpr concepts::time_type condition_variable_time = concepts::time_type::std;
+		friend locked_ptr_t;
+		friend shared_locked_ptr_t;
+		friend upgrade_locked_ptr_t;
+		friend scoped_unlock_t;
+		friend synchro_vault_t;
+
+	public:
+		ctrl_block(const ctrl_block& cb) = delete;
+		ctrl_block(ctrl_block&& cb) noexcept = delete;
+		ctrl_block& operator=(const ctrl_block& cb) = delete;
+		ctrl_block& operator=(ctrl_block&& cb) noexcept = delete;
+		~ctrl_block() = default;
+	protected:
+		ctrl_block() noexcept(std::is_nothrow_default_constructible_v<locked_datum_t>)
+			requires (std::is_default_constructible_v<locked_datum_t>)
+			: m_mutex{}, m_condition_variable{}, m_locked{} {}
+		explicit ctrl_block(const locked_datum_t& locked)
+			noexcept(std::is_nothrow_copy_constructible_v<locked_datum_t>)
+			requires std::copy_constructible<locked_datum_t> : m_mutex{}, m_condition_variable{}, m_locked{ locked } {}
+
+		explicit ctrl_block(locked_datum_t&& locked)
+			noexcept(std::is_nothrow_move_constructible_v<locked_datum_t>)
+			requires (std::move_constructible<locked_datum_t>) : m_mutex{}, m_condition_variable{}, m_locked{ std::move(locked) } {}
+		template<typename...TArgs>
+			requires (std::constructible_from<locked_datum_t, TArgs...>)
+		ctrl_block(TArgs&&... args)
+			noexcept(cjm::concepts::nothrow_constructible_from<locked_datum_t,
+				TArgs...>)
+			: m_mutex{}, m_condition_variable{},
+			m_locked{ std::forward<TArgs>(args)... } {}
+
+		alignas(layout_t::template lock_align<mutex_t>) mutable mutex_t m_mutex;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS alignas(layout_t::template cold_align<condition_variable_t>)
+			mutable condition_variable_t m_condition_variable;
+		alignas(layout_t::template hot_align<locked_datum_t>) locked_datum_t m_locked;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS mutable stats_t m_stats;
+	};
+
+	template<typename TLocked, concepts::upgrade_mutex TMutex>
+	class locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>
+	{
+	public:
+		using release_notifier_t = release_notifier_for_t<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		friend scoped_unlock_t;
+		using locked_t = std::remove_reference_t<TLocked>;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using shared_lock_t = std::shared_lock<TMutex>;
+		using upgrade_lock_t = boost::upgrade_lock<TMutex>;
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using shared_locked_ptr_t = shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using upgrade_locked_ptr_t = upgrade_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		friend ctrl_blck_t;
+		friend synchro_vault_t;
+		friend upgrade_locked_ptr_t;
+		using ctrl_blck_ptr_t = std::add_pointer_t<ctrl_blck_t>;
+		using stats_t = typename ctrl_blck_t::stats_t;
+		using hold_timer_t = typename stats_t::hold_timer_t;
+		static constexpr concepts::time_type condition_variable_time = ctrl_blck_t::condition_variable_time;
+
+		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ctrl_blck_ptr_t>;
+		~locked_ptr_base();
+		locked_ptr_base(const locked_ptr_base& other) = delete;
+		locked_ptr_base(locked_ptr_base&& other) noexcept
+			: m_release_notifier{ std::move(other.m_release_notifier) },
+			m_lock{ std::move(other.m_lock) }, m_ctrl_blck{ std::exchange(other.m_ctrl_blck, nullptr) },
+			m_hold_timer{ other.m_hold_timer } {}
+		locked_ptr_base& operator=(const locked_ptr_base& other) = delete;
+		locked_ptr_base& operator=(locked_ptr_base&& other) noexcept;
+
+	protected:
+
+		lock_release_notify lock_release_setting() const noexcept
+		{
+			return m_release_notifier.setting();
+		}
+
+		void release_impl() noexcept;
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock_impl(const call_site_t& site);
+
+		[[nodiscard]] shared_locked_ptr_t downgrade_to_shared_impl();
+
+		[[nodiscard]] upgrade_locked_ptr_t downgrade_to_upgrade_impl();
+
+		void notify_one_impl()
+		{
+			m_ctrl_blck->m_condition_variable.notify_one();
+		}
+
+		void notify_all_impl()
+		{
+			m_ctrl_blck->m_condition_variable.notify_all();
+		}
+
+		void set_cv_release_notification(lock_release_notify lrn)
+			requires (release_notifier_t::policy == release_notify_policy::runtime)
+		{
+			assert(lrn >= lock_release_notify::none && lrn <= lock_release_notify::all);
+			m_release_notifier.set(lrn);
+		}
+
+		template<concepts::duration Duration>
+		void wait_for_impl(const Duration& d)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_for(m_lock, d);
+		}
+
+		template<concepts::duration Duration, std::predicate Predicate>
+		void wait_for_impl(const Duration& d, Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_for(m_lock, d, p);
+		}
+
+		template<concepts::time_point TimePoint>
+		void wait_until_impl(const TimePoint& tp)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp);
+		}
+
+		template<concepts::time_point TimePoint, std::predicate Predicate>
+		void wait_until_impl(const TimePoint& tp, Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp, p);
+		}
+
+		void wait_impl()
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait(m_lock);
+		}
+
+		template<std::predicate Predicate>
+		void wait_impl(Predicate p)
+		{
+			assert(is_locked_impl());
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				bool woken = false;
+				m_ctrl_blck->m_condition_variable.wait(m_lock, m_ctrl_blck->m_stats.count_wakeups(p, woken));
+			}
+			else
+			{
+				m_ctrl_blck->m_condition_variable.wait(m_lock, p);
+			}
+		}
+
+		[[nodiscard]] std::add_lvalue_reference_t<locked_t> locked_value() const;
+
+		[[nodiscard]] bool is_empty_impl() const noexcept
+		{
+			return get_mutex_impl() == nullptr && m_ctrl_blck == nullptr;
+		}
+
+		void lock_impl(unlocker_data_t unlocker_data, const call_site_t& site)
+		{
+			assert(!is_locked_impl());
+			m_lock = std::move(unlocker_data.first);
+			m_ctrl_blck = unlocker_data.second;
+			assert(m_ctrl_blck != nullptr && m_lock.mutex() != nullptr && !m_lock.owns_lock());
+			if constexpr (stats_t::enabled)
+			{
+				m_ctrl_blck->m_stats.lock(m_lock, site);
+				m_hold_timer.start();
+			}
+			else
+			{
+				m_lock.lock();
+			}
+			assert(is_locked_impl());
+		}
+
+		unlocker_data_t unlock_impl()
+		{
+			assert(is_locked_impl());
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
+			unlocker_data_t ret = std::make_pair(std::move(m_lock), m_ctrl_blck);
+			m_ctrl_blck = nullptr;
+			ret.first.unlock();
+			assert(ret.second != nullptr && !is_locked_impl() && is_empty_impl());
+			return ret;
+		}
+
+		[[nodiscard]] bool is_locked_impl() const noexcept
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			return m_lock.owns_lock();
+		}
+
+		[[nodiscard]] mutex_t* get_mutex_impl() const noexcept
+		{
+			return m_lock.mutex();
+		}
+
+		explicit locked_ptr_base(std::unique_lock<mutex_t> lock, ctrl_blck_ptr_t locked, const call_site_t& site = call_site_t{}) : m_lock{ std::move(lock) }, m_ctrl_blck{ locked }
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			if constexpr (stats_t::enabled)
+			{
+				if (m_lock.owns_lock())
+				{
+					m_hold_timer.start(site);
+				}
+			}
+		}
+		locked_ptr_base() = default;
+	private:
+
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS release_notifier_t m_release_notifier;
+		lock_t m_lock;
+		ctrl_blck_ptr_t m_ctrl_blck{nullptr};
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS hold_timer_t m_hold_timer;
+	};
+
+	template<typename TLocked, concepts::upgrade_mutex TMutex>
+	class shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>
+	{
+	public:
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		friend scoped_unlock_t;
+		using locked_t = std::remove_reference_t<TLocked>;
+		using const_locked_t = std::add_const_t<locked_t>;
+		using mutex_t = TMutex;
+		using shared_lock_t = std::shared_lock<TMutex>;
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using locked_ptr_t = locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using upgrade_locked_ptr_t = upgrade_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		friend ctrl_blck_t;
+		friend synchro_vault_t;
+		friend locked_ptr_t;
+		friend upgrade_locked_ptr_t;
+		using ctrl_blck_ptr_t = std::add_pointer_t<std::add_const_t<ctrl_blck_t>>;
+		static constexpr concepts::time_type condition_variable_time = ctrl_blck_t::condition_variable_time;
+
+		using unlocker_data_t = std::pair<std::shared_lock<mutex_t>, ctrl_blck_ptr_t>;
+		~shared_locked_ptr_base() = default;
+		shared_locked_ptr_base(const shared_locked_ptr_base& other) = delete;
+		shared_locked_ptr_base(shared_locked_ptr_base&& other) noexcept
+			: m_lock{ std::move(other.m_lock) }, m_ctrl_blck{ std::exchange(other.m_ctrl_blck, nullptr) } {}
+		shared_locked_ptr_base& operator=(const shared_locked_ptr_base& other) = delete;
+		shared_locked_ptr_base& operator=(shared_locked_ptr_base&& other) noexcept
+		{
+			if (this != &other)
+			{
+				m_lock = std::move(other.m_lock);
+				m_ctrl_blck = std::exchange(other.m_ctrl_blck, nullptr);
+			}
+			return *this;
+		}
+
+	protected:
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock_impl(const call_site_t& site);
+
+		template<concepts::duration Duration, std::predicate Predicate>
+		bool wait_for_impl(const Duration& d, Predicate p)
+		{
+			assert(is_locked_impl());
+			return m_ctrl_blck->m_condition_variable.wait_for(m_lock, d, p);
+		}
+
+		template<concepts::time_point TimePoint, std::predicate Predicate>
+		bool wait_until_impl(const TimePoint& tp, Predicate p)
+		{
+			assert(is_locked_impl());
+			return m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp, p);
+		}
+
+		template<std::predicate Predicate>
+		void wait_impl(Predicate p)
+		{
+			assert(is_locked_impl());
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				bool woken = false;
+				m_ctrl_blck->m_condition_variable.wait(m_lock, m_ctrl_blck->m_stats.count_wakeups(p, woken));
+			}
+			else
+			{
+				m_ctrl_blck->m_condition_variable.wait(m_lock, p);
+			}
+		}
+
+		[[nodiscard]] std::add_lvalue_reference_t<const_locked_t> locked_value() const
+		{
+			assert(is_locked_impl() && m_ctrl_blck != nullptr);
+			return m_ctrl_blck->m_locked;
+		}
+
+		[[nodiscard]] bool is_empty_impl() const noexcept
+		{
+			return get_mutex_impl() == nullptr && m_ctrl_blck == nullptr;
+		}
+
+		void lock_impl(unlocker_data_t unlocker_data, const call_site_t& site)
+		{
+			assert(!is_locked_impl());
+			m_lock = std::move(unlocker_data.first);
+			m_ctrl_blck = unlocker_data.second;
+			assert(m_ctrl_blck != nullptr && m_lock.mutex() != nullptr && !m_lock.owns_lock());
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				m_ctrl_blck->m_stats.lock(m_lock, site);
+			}
+			else
+			{
+				m_lock.lock();
+			}
+			assert(is_locked_impl());
+		}
+
+		unlocker_data_t unlock_impl()
+		{
+			assert(is_locked_impl());
+			unlocker_data_t ret = std::make_pair(std::move(m_lock), m_ctrl_blck);
+			m_ctrl_blck = nullptr;
+			ret.first.unlock();
+			assert(ret.second != nullptr && !is_locked_impl() && is_empty_impl());
+			return ret;
+		}
+
+		[[nodiscard]] bool is_locked_impl() const noexcept
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			return m_lock.owns_lock();
+		}
+
+		[[nodiscard]] mutex_t* get_mutex_impl() const noexcept
+		{
+			return m_lock.mutex();
+		}
+
+		explicit shared_locked_ptr_base(std::shared_lock<mutex_t> lock, ctrl_blck_ptr_t locked) : m_lock{ std::move(lock) }, m_ctrl_blck{ locked }
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+		}
+		shared_locked_ptr_base() = default;
+	private:
+		shared_lock_t m_lock;
+		ctrl_blck_ptr_t m_ctrl_blck{nullptr};
+	};
+
+	// Upgrade ownership coexists with shared owners, so access through it is const until it is
+	// turned into an exclusive pointer with upgrade_impl().  Neither transition releases the mutex.
+	template<typename TLocked, concepts::upgrade_mutex TMutex>
+	class upgrade_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>
+	{
+	public:
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		friend scoped_unlock_t;
+		using locked_t = std::remove_reference_t<TLocked>;
+		using const_locked_t = std::add_const_t<locked_t>;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using shared_lock_t = std::shared_lock<TMutex>;
+		using upgrade_lock_t = boost::upgrade_lock<TMutex>;
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using locked_ptr_t = locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using shared_locked_ptr_t = shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		friend ctrl_blck_t;
+		friend synchro_vault_t;
+		friend locked_ptr_t;
+		using ctrl_blck_ptr_t = std::add_pointer_t<ctrl_blck_t>;
+		static constexpr concepts::time_type condition_variable_time = ctrl_blck_t::condition_variable_time;
+
+		using unlocker_data_t = std::pair<upgrade_lock_t, ctrl_blck_ptr_t>;
+		~upgrade_locked_ptr_base() = default;
+		upgrade_locked_ptr_base(const upgrade_locked_ptr_base& other) = delete;
+		upgrade_locked_ptr_base(upgrade_locked_ptr_base&& other) noexcept
+			: m_lock{ std::move(other.m_lock) }, m_ctrl_blck{ std::exchange(other.m_ctrl_blck, nullptr) } {}
+		upgrade_locked_ptr_base& operator=(const upgrade_locked_ptr_base& other) = delete;
+		upgrade_locked_ptr_base& operator=(upgrade_locked_ptr_base&& other) noexcept
+		{
+			if (this != &other)
+			{
+				m_lock = std::move(other.m_lock);
+				m_ctrl_blck = std::exchange(other.m_ctrl_blck, nullptr);
+			}
+			return *this;
+		}
+
+	protected:
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock_impl(const call_site_t& site);
+
+		[[nodiscard]] locked_ptr_t upgrade_impl(const call_site_t& site)
+		{
+			assert(is_locked_impl());
+			ctrl_blck_ptr_t ctrl_blck = std::exchange(m_ctrl_blck, nullptr);
+			mutex_t* mutex = m_lock.release();
+			mutex->unlock_upgrade_and_lock();
+			return locked_ptr_t{ lock_t{*mutex, std::adopt_lock}, ctrl_blck, site };
+		}
+
+		[[nodiscard]] shared_locked_ptr_t downgrade_to_shared_impl()
+		{
+			assert(is_locked_impl());
+			ctrl_blck_ptr_t ctrl_blck = std::exchange(m_ctrl_blck, nullptr);
+			mutex_t* mutex = m_lock.release();
+			mutex->unlock_upgrade_and_lock_shared();
+			return shared_locked_ptr_t{ shared_lock_t{*mutex, std::adopt_lock}, ctrl_blck };
+		}
+
+		template<std::predicate Predicate>
+		void wait_impl(Predicate p)
+		{
+			assert(is_locked_impl());
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				bool woken = false;
+				m_ctrl_blck->m_condition_variable.wait(m_lock, m_ctrl_blck->m_stats.count_wakeups(p, woken));
+			}
+			else
+			{
+				m_ctrl_blck->m_condition_variable.wait(m_lock, p);
+			}
+		}
+
+		[[nodiscard]] std::add_lvalue_reference_t<const_locked_t> locked_value() const
+		{
+			assert(is_locked_impl() && m_ctrl_blck != nullptr);
+			return m_ctrl_blck->m_locked;
+		}
+
+		[[nodiscard]] bool is_empty_impl() const noexcept
+		{
+			return get_mutex_impl() == nullptr && m_ctrl_blck == nullptr;
+		}
+
+		void lock_impl(unlocker_data_t unlocker_data, const call_site_t& site)
+		{
+			assert(!is_locked_impl());
+			m_lock = std::move(unlocker_data.first);
+			m_ctrl_blck = unlocker_data.second;
+			assert(m_ctrl_blck != nullptr && m_lock.mutex() != nullptr && !m_lock.owns_lock());
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				m_ctrl_blck->m_stats.lock(m_lock, site);
+			}
+			else
+			{
+				m_lock.lock();
+			}
+			assert(is_locked_impl());
+		}
+
+		unlocker_data_t unlock_impl()
+		{
+			assert(is_locked_impl());
+			unlocker_data_t ret = std::make_pair(std::move(m_lock), m_ctrl_blck);
+			m_ctrl_blck = nullptr;
+			ret.first.unlock();
+			assert(ret.second != nullptr && !is_locked_impl() && is_empty_impl());
+			return ret;
+		}
+
+		[[nodiscard]] bool is_locked_impl() const noexcept
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			return m_lock.owns_lock();
+		}
+
+		[[nodiscard]] mutex_t* get_mutex_impl() const noexcept
+		{
+			return m_lock.mutex();
+		}
+
+		explicit upgrade_locked_ptr_base(upgrade_lock_t lock, ctrl_blck_ptr_t locked) : m_lock{ std::move(lock) }, m_ctrl_blck{ locked }
+		{
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+		}
+		upgrade_locked_ptr_base() = default;
+	private:
+		upgrade_lock_t m_lock;
+		ctrl_blck_ptr_t m_ctrl_blck{nullptr};
+	};
+
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	class scoped_unlock<TLocked, TMutex, concepts::mutex_level::upgrade>
+	{
+	public:
+		using locked_ptr_base_t = locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using shared_locked_ptr_base_t = shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using upgrade_locked_ptr_base_t = upgrade_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using unlocker_data_t = typename locked_ptr_base_t::unlocker_data_t;
+		using call_site_t = typename locked_ptr_base_t::call_site_t;
+		using shared_unlocker_data_t = typename shared_locked_ptr_base_t::unlocker_data_t;
+		using upgrade_unlocker_data_t = typename upgrade_locked_ptr_base_t::unlocker_data_t;
+		scoped_unlock& operator=(scoped_unlock&& other) noexcept = delete;
+		scoped_unlock& operator=(const scoped_unlock& other) = delete;
+		scoped_unlock() = delete;
+		scoped_unlock(scoped_unlock&& other) noexcept = delete;
+		scoped_unlock(const scoped_unlock& other) = delete;
+		explicit scoped_unlock(locked_ptr_base_t& locked_ptr, const call_site_t& site)
+			: m_unlocker_data{}, m_shared_unlocker_data{}, m_upgrade_unlocker_data{},
+			m_ptr(&locked_ptr), m_shared_ptr{nullptr}, m_upgrade_ptr{nullptr}, m_site{ site }
+		{
+			assert(locked_ptr.is_locked_impl());
+			m_unlocker_data = locked_ptr.unlock_impl();
+			assert(!m_ptr->is_locked_impl() && m_unlocker_data.second != nullptr);
+		}
+		explicit scoped_unlock(shared_locked_ptr_base_t& shared_locked_ptr, const call_site_t& site)
+			: m_unlocker_data{}, m_shared_unlocker_data{}, m_upgrade_unlocker_data{},
+			m_ptr{nullptr}, m_shared_ptr(&shared_locked_ptr), m_upgrade_ptr{nullptr}, m_site{ site }
+		{
+			assert(shared_locked_ptr.is_locked_impl());
+			m_shared_unlocker_data = shared_locked_ptr.unlock_impl();
+			assert(!m_shared_ptr->is_locked_impl() && m_shared_unlocker_data.second != nullptr);
+		}
+		explicit scoped_unlock(upgrade_locked_ptr_base_t& upgrade_locked_ptr, const call_site_t& site)
+			: m_unlocker_data{}, m_shared_unlocker_data{}, m_upgrade_unlocker_data{},
+			m_ptr{nullptr}, m_shared_ptr{nullptr}, m_upgrade_ptr(&upgrade_locked_ptr), m_site{ site }
+		{
+			assert(upgrade_locked_ptr.is_locked_impl());
+			m_upgrade_unlocker_data = upgrade_locked_ptr.unlock_impl();
+			assert(!m_upgrade_ptr->is_locked_impl() && m_upgrade_unlocker_data.second != nullptr);
+		}
+		~scoped_unlock()
+		{
+			if (m_ptr != nullptr)
+			{
+				assert(!m_ptr->is_locked_impl());
+				m_ptr->lock_impl(std::move(m_unlocker_data), m_site);
+				assert(m_ptr->is_locked_impl());
+			}
+			else if (m_shared_ptr != nullptr)
+			{
+				assert(!m_shared_ptr->is_locked_impl());
+				m_shared_ptr->lock_impl(std::move(m_shared_unlocker_data), m_site);
+				assert(m_shared_ptr->is_locked_impl());
+			}
+			else
+			{
+				assert(m_upgrade_ptr != nullptr && !m_upgrade_ptr->is_locked_impl());
+				m_upgrade_ptr->lock_impl(std::move(m_upgrade_unlocker_data), m_site);
+				assert(m_upgrade_ptr->is_locked_impl());
+			}
+		}
+
+	private:
+		unlocker_data_t m_unlocker_data;
+		shared_unlocker_data_t m_shared_unlocker_data;
+		upgrade_unlocker_data_t m_upgrade_unlocker_data;
+		locked_ptr_base_t* m_ptr;
+		shared_locked_ptr_base_t* m_shared_ptr;
+		upgrade_locked_ptr_base_t* m_upgrade_ptr;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS call_site_t m_site;
+	};
+
+	template<typename TLocked, concepts::upgrade_mutex TMutex>
+	class synchro_vault_base<TLocked, TMutex, concepts::mutex_level::upgrade>
+	{
+	protected:
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::upgrade>;
+		using locked_t = typename ctrl_blck_t::locked_datum_t;
+		using mutex_t = typename ctrl_blck_t::mutex_t;
+		using lock_t = typename ctrl_blck_t::lock_t;
+		using shared_lock_t = typename ctrl_blck_t::shared_lock_t;
+		using upgrade_lock_t = typename ctrl_blck_t::upgrade_lock_t;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using ptr_to_locked = typename ctrl_blck_t::ptr_to_locked_datum;
+		using unlocker_data_t = typename ctrl_blck_t::unlocker_data_t;
+		using vault_owner_t = typename ctrl_blck_t::vault_owner_t;
+		static_assert(std::is_same_v<synchro_vault_base<TLocked, TMutex, concepts::mutex_level::upgrade>, vault_owner_t>);
+		using locked_ptr_t = typename ctrl_blck_t::locked_ptr_t;
+		using shared_locked_ptr_t = typename ctrl_blck_t::shared_locked_ptr_t;
+		using upgrade_locked_ptr_t = typename ctrl_blck_t::upgrade_locked_ptr_t;
+		friend ctrl_blck_t;
+		friend scoped_unlock_t;
+
+		synchro_vault_base() noexcept(std::is_nothrow_default_constructible_v<locked_t>)
+			requires (std::is_default_constructible_v<locked_t>) : m_ctrl_blck{} {}
+		synchro_vault_base(const locked_t& locked_datum) noexcept(std::is_nothrow_copy_constructible_v<locked_t>)
+			requires (std::copy_constructible<locked_t>) : m_ctrl_blck{ locked_datum } {}
+		synchro_vault_base(locked_t&& locked_datum) noexcept(std::is_nothrow_move_constructible_v<locked_t>)
+			requires (std::move_constructible<locked_t>) : m_ctrl_blck{ std::move(locked_datum) } {}
+		template<typename...TArgs>
+		requires (std::constructible_from<locked_t, TArgs...>)
+			synchro_vault_base(TArgs&&... args) noexcept(cjm::concepts::nothrow_constructible_from<locked_t,
+				TArgs...>) : m_ctrl_blck{ std::forward<TArgs>(args)... } {}
+
+		[[nodiscard]] locked_ptr_t lock_impl(const call_site_t& site)
+		{
+			return locked_ptr_t{ acquire_lock<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex, site), &m_ctrl_blck, site };
+		}
+
+		[[nodiscard]] lock_t defer_lock_impl() const
+		{
+			return lock_t{ m_ctrl_blck.m_mutex, std::defer_lock };
+		}
+
+		[[nodiscard]] locked_ptr_t adopt_lock_impl(lock_t lock, const call_site_t& site = call_site_t{})
+		{
+			assert(lock.owns_lock() && lock.mutex() == &m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_stats.adopt(lock, site);
+			return locked_ptr_t{ std::move(lock), &m_ctrl_blck, site };
+		}
+
+		[[nodiscard]] shared_locked_ptr_t lock_shared_impl(const call_site_t& site) const
+		{
+			return shared_locked_ptr_t{ acquire_lock<shared_lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex, site), &m_ctrl_blck };
+		}
+
+		[[nodiscard]] shared_lock_t defer_lock_shared_impl() const
+		{
+			return shared_lock_t{ m_ctrl_blck.m_mutex, std::defer_lock };
+		}
+
+		[[nodiscard]] shared_locked_ptr_t adopt_lock_impl(shared_lock_t lock, const call_site_t& site = call_site_t{}) const
+		{
+			assert(lock.owns_lock() && lock.mutex() == &m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_stats.adopt(lock, site);
+			return shared_locked_ptr_t{ std::move(lock), &m_ctrl_blck };
+		}
+
+		[[nodiscard]] upgrade_locked_ptr_t lock_upgrade_impl(const call_site_t& site)
+		{
+			return upgrade_locked_ptr_t{ acquire_lock<upgrade_lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex, site), &m_ctrl_blck };
+		}
+
+		[[nodiscard]] upgrade_lock_t defer_lock_upgrade_impl() const
+		{
+			return upgrade_lock_t{ m_ctrl_blck.m_mutex, boost::defer_lock };
+		}
+
+		[[nodiscard]] upgrade_locked_ptr_t adopt_lock_impl(upgrade_lock_t lock, const call_site_t& site = call_site_t{})
+		{
+			assert(lock.owns_lock() && lock.mutex() == &m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_stats.adopt(lock, site);
+			return upgrade_locked_ptr_t{ std::move(lock), &m_ctrl_blck };
+		}
+
+		void notify_one_impl()
+		{
+			m_ctrl_blck.m_condition_variable.notify_one();
+		}
+
+		void notify_all_impl()
+		{
+			m_ctrl_blck.m_condition_variable.notify_all();
+		}
+
+		[[nodiscard]] typename ctrl_blck_t::stats_t& stats_impl() const noexcept
+		{
+			return m_ctrl_blck.m_stats;
+		}
+
+		[[nodiscard]] auto copy_locked_datum() const
+			noexcept(std::is_nothrow_copy_constructible_v<locked_t>)->locked_t
+			requires (std::copy_constructible<locked_t>)
+		{
+			auto lock = scoped_acquire<shared_lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			return m_ctrl_blck.m_locked;
+		}
+
+		auto release_locked_datum() noexcept -> locked_t
+			requires (std::is_nothrow_move_constructible_v<locked_t>&& std::is_nothrow_default_constructible_v<locked_t>)
+		{
+			locked_t def_val;
+			auto lock = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			std::swap(m_ctrl_blck.m_locked, def_val);
+			return def_val;
+		}
+
+		auto swap_locked_datum(locked_t&& swap_me) noexcept -> locked_t
+			requires (std::is_nothrow_swappable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			std::swap(swap_me, m_ctrl_blck.m_locked);
+			return swap_me;
+		}
+
+		void assign_locked_datum(const locked_t& new_datum)
+			noexcept (std::is_nothrow_copy_assignable_v<locked_t>)
+			requires(std::is_copy_assignable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_locked = new_datum;
+		}
+
+		void assign_locked_datum(locked_t&& new_datum)
+			noexcept(std::is_nothrow_move_assignable_v<locked_t>)
+			requires(std::is_move_assignable_v<locked_t>)
+		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_locked = std::move(new_datum);
+		}
+
+	private:
+		ctrl_blck_t m_ctrl_blck;
 	};
 
-	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
-	class ctrl_block;
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::~locked_ptr_base()
+	{
+		release_impl();
+	}
 
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::operator=(locked_ptr_base&& other) noexcept -> locked_ptr_base&
+	{
+		if (this != &other)
+		{
+			release_impl();
+			m_release_notifier = std::move(other.m_release_notifier);
+			m_lock = std::move(other.m_lock);
+			m_ctrl_blck = std::exchange(other.m_ctrl_blck, nullptr);
+			m_hold_timer = other.m_hold_timer;
+		}
+		return *this;
+	}
 
-	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
-	class locked_ptr_base;
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	void locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::release_impl() noexcept
+	{
+		const lock_release_notify notify = m_release_notifier.take();
+		if (m_lock.owns_lock())
+		{
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
+			m_lock.unlock();
+		}
+		if (m_ctrl_blck == nullptr)
+		{
+			return;
+		}
+		if (notify == lock_release_notify::one)
+		{
+			m_ctrl_blck->m_condition_variable.notify_one();
+		}
+		else if (notify == lock_release_notify::all)
+		{
+			m_ctrl_blck->m_condition_variable.notify_all();
+		}
+		m_ctrl_blck = nullptr;
+	}
 
-	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
-	class scoped_unlock;
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::scoped_unlock_impl(const call_site_t& site) -> scoped_unlock_t
+	{
+		return scoped_unlock_t{ *this, site };
+	}
 
-	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
-	class synchro_vault_base;
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::downgrade_to_shared_impl() -> shared_locked_ptr_t
+	{
+		assert(is_locked_impl());
+		if constexpr (stats_t::enabled)
+		{
+			m_hold_timer.stop(m_ctrl_blck->m_stats);
+		}
+		ctrl_blck_ptr_t ctrl_blck = std::exchange(m_ctrl_blck, nullptr);
+		mutex_t* mutex = m_lock.release();
+		mutex->unlock_and_lock_shared();
+		return shared_locked_ptr_t{ shared_lock_t{*mutex, std::adopt_lock}, ctrl_blck };
+	}
 
-	template<typename TLocked, concepts::mutex TMutex, concepts::mutex_level Level>
-	class ctrl_block
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::downgrade_to_upgrade_impl() -> upgrade_locked_ptr_t
+	{
+		assert(is_locked_impl());
+		if constexpr (stats_t::enabled)
+		{
+			m_hold_timer.stop(m_ctrl_blck->m_stats);
+		}
+		ctrl_blck_ptr_t ctrl_blck = std::exchange(m_ctrl_blck, nullptr);
+		mutex_t* mutex = m_lock.release();
+		mutex->unlock_and_lock_upgrade();
+		return upgrade_locked_ptr_t{ upgrade_lock_t{*mutex, boost::adopt_lock}, ctrl_blck };
+	}
+
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::locked_value() const -> std::add_lvalue_reference_t<typename locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::locked_t>
+	{
+		assert(is_locked_impl() && m_ctrl_blck != nullptr);
+		return m_ctrl_blck->m_locked;
+	}
+
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	auto shared_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::scoped_unlock_impl(const call_site_t& site) -> scoped_unlock_t
+	{
+		return scoped_unlock_t{ *this, site };
+	}
+
+	template <typename TLocked, concepts::upgrade_mutex TMutex>
+	auto upgrade_locked_ptr_base<TLocked, TMutex, concepts::mutex_level::upgrade>::scoped_unlock_impl(const call_site_t& site) -> scoped_unlock_t
+	{
+		return scoped_unlock_t{ *this, site };
+	}
+#endif
+
+	// At the seqlock level writers serialize on m_mutex and bump m_sequence to an odd value for
+	// the duration of their exclusive ownership.  Readers never touch the mutex: they copy the
+	// datum and retry if the sequence was odd or changed underneath them, so a read performs no
+	// writes to shared memory.
+	template<typename TLocked, concepts::mutex TMutex>
+	class ctrl_block<TLocked, TMutex, concepts::mutex_level::seqlock>
 	{
 	protected:
-		static constexpr concepts::mutex_level level = Level;
-	
-		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, Level>;
-		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, Level>;
+		static constexpr concepts::mutex_level level = concepts::mutex_level::seqlock;
+
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::seqlock>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::seqlock>;
 		using locked_datum_t = std::remove_reference_t<TLocked>;
-		using const_locked_datum_t = std::add_const_t<locked_datum_t>;
-		using locked_datum_ref_t = std::add_lvalue_reference_t<locked_datum_t>;
-		using const_locked_datum_ref_t = std::add_lvalue_reference_t<const_locked_datum_t>;
+		static_assert(std::is_trivially_copyable_v<locked_datum_t>, "The seqlock level requires a trivially copyable datum.");
 		using mutex_t = TMutex;
 		using lock_t = std::unique_lock<TMutex>;
-		using shared_lock_t = std::conditional_t<level == concepts::mutex_level::shared || level == concepts::mutex_level::upgrade, std::shared_lock<mutex_t>, void>;
-		using upgrade_lock_t = std::conditional_t<using_boost&& level == concepts::mutex_level::upgrade, boost::upgrade_lock<TMutex>, void>;
-		using condition_variable_t = std::conditional_t<Level == concepts::mutex_level::std_mutex, std::condition_variable, std::condition_variable_any>;
+		using condition_variable_t = vault_condition_t<TLocked, TMutex, level,
+			std::conditional_t<std::is_same_v<TMutex, std::mutex>, std::condition_variable, condition_variable_for_t<TMutex, level>>>;
+		using stats_t = vault_stats_for_t<TLocked, TMutex, level>;
+		using call_site_t = typename stats_t::site_t;
+		using layout_t = ctrl_block_layout<TLocked, TMutex, level>;
+		using sequence_t = std::uint64_t;
 		using ptr_to_locked_datum = std::add_pointer_t<locked_datum_t>;
-		using ptr_to_const_locked_datum = std::add_pointer_t<const_locked_datum_t>;
-		using const_ptr_to_locked_datum = std::add_const_t<ptr_to_const_locked_datum>;
-		using const_ptr_to_const_locked_datum = std::add_const_t<ptr_to_const_locked_datum>;
 		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ptr_to_locked_datum>;
-		using vault_owner_t = synchro_vault_base<TLocked, TMutex, Level>;
-		using locked_ptr_t = locked_ptr_base<TLocked, TMutex, Level>;
+		using vault_owner_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::seqlock>;
+		using locked_ptr_t = locked_ptr_base<TLocked, TMutex, concepts::mutex_level::seqlock>;
 		static constexpr concepts::time_type condition_variable_time = concepts::time_type::std;
-		friend class locked_ptr_t;
-		friend class scoped_unlock_t;
-		friend class synchro_vault_t;
+		friend locked_ptr_t;
+		friend scoped_unlock_t;
+		friend synchro_vault_t;
 
-		std::pair<lock_t, ctrl_block*> lock_impl() const
+		void begin_write() noexcept
 		{
-			return std::make_pair(lock_t{ m_mutex }, this);
+			const sequence_t seq = m_sequence.load(std::memory_order_relaxed);
+			assert((seq & 1u) == 0);
+			m_sequence.store(seq + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
 		}
-	public:
-		ctrl_block(const ctrl_block& cb) = delete;
-		ctrl_block(ctrl_block&& cb) noexcept = delete;
-		ctrl_block& operator=(const ctrl_block& cb) = delete;
-		ctrl_block& operator=(ctrl_block&& cb) noexcept = delete;
-		~ctrl_block() = default;
-	protected:
-		ctrl_block() noexcept(std::is_nothrow_default_constructible_v<locked_datum_t>)
-			requires (std::is_default_constructible_v<locked_datum_t>)
-			: m_mutex{}, m_condition_variable{}, m_locked{} {}
-		explicit ctrl_block(const locked_datum_t & locked)
-			noexcept(std::is_nothrow_copy_constructible_v<locked_datum_t>)
-			requires std::copy_constructible<locked_datum_t> : m_mutex{}, m_condition_variable{}, m_locked{ locked } {}
-
 
-		explicit ctrl_block(locked_datum_t && locked)
-			noexcept(std::is_nothrow_move_constructible_v<locked_datum_t>)
-			requires (std::move_constructible<locked_datum_t>) : m_mutex{}, m_condition_variable{}, m_locked{ std::move(locked) } {}
-		template<typename...TArgs>
-		requires (std::constructible_from<locked_datum_t, TArgs...>)
-			ctrl_block(TArgs&&... args)
-			noexcept(cjm::concepts::nothrow_constructible_from<locked_datum_t,
-				TArgs...>)
-			: m_mutex{}, m_condition_variable{},
-			m_locked{ std::forward<TArgs>(args)... } {}
-		mutable mutex_t m_mutex;
-		mutable condition_variable_t m_condition_variable;
-		locked_datum_t m_locked;
-	};
-	
-	template<typename TLocked>
-	class ctrl_block<TLocked, std::mutex, concepts::mutex_level::std_mutex>
-	{
-	protected:
-		using synchro_vault_t = synchro_vault_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
-		using scoped_unlock_t = scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
-		using locked_datum_t = std::remove_reference_t<TLocked>;
-		using mutex_t = std::mutex;
-		using lock_t = std::unique_lock<std::mutex>;
-		using condition_variable_t = std::condition_variable;
-		using ptr_to_locked = locked_datum_t*;
-		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ptr_to_locked>;
-		using vault_owner_t = synchro_vault_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
-		using locked_ptr_t = locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
-		static constexpr concepts::time_type condition_variable_time = concepts::time_type::std;
-		static constexpr concepts::mutex_level level = concepts::mutex_level::std_mutex;
-		friend class locked_ptr_t;
-		friend class scoped_unlock_t;
-		friend class synchro_vault_t;
+		void end_write() noexcept
+		{
+			const sequence_t seq = m_sequence.load(std::memory_order_relaxed);
+			assert((seq & 1u) == 1);
+			m_sequence.store(seq + 1, std::memory_order_release);
+		}
 
-		std::pair<lock_t, ctrl_block*> lock_impl() const
+		[[nodiscard]] locked_datum_t read_optimistic() const noexcept
 		{
-			return std::make_pair(lock_t{ m_mutex }, this);
+			std::array<std::byte, sizeof(locked_datum_t)> bytes;
+			for (unsigned spins = 0; ; ++spins)
+			{
+				const sequence_t before = m_sequence.load(std::memory_order_acquire);
+				if ((before & 1u) == 0)
+				{
+					std::memcpy(bytes.data(), std::addressof(m_locked), sizeof(locked_datum_t));
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (m_sequence.load(std::memory_order_relaxed) == before)
+					{
+						return std::bit_cast<locked_datum_t>(bytes);
+					}
+				}
+				if (spins < 64)
+				{
+					cpu_relax();
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
 		}
 
 	public:
@@ -138,58 +4047,67 @@ namespace cjm::synchro::detail
 	protected:
 		ctrl_block() noexcept(std::is_nothrow_default_constructible_v<locked_datum_t>)
 			requires (std::is_default_constructible_v<locked_datum_t>)
-			: m_mutex{}, m_condition_variable{}, m_locked{} {}
+			: m_mutex{}, m_condition_variable{}, m_sequence{0}, m_locked{} {}
 		explicit ctrl_block(const locked_datum_t& locked)
 			noexcept(std::is_nothrow_copy_constructible_v<locked_datum_t>)
-			requires std::copy_constructible<locked_datum_t> : m_mutex{}, m_condition_variable{}, m_locked{locked} {}
-
-		
-		explicit ctrl_block(locked_datum_t&& locked)
-			noexcept(std::is_nothrow_move_constructible_v<locked_datum_t>)
-			requires (std::move_constructible<locked_datum_t>) : m_mutex{}, m_condition_variable{}, m_locked{std::move(locked)} {}
+			requires std::copy_constructible<locked_datum_t> : m_mutex{}, m_condition_variable{}, m_sequence{0}, m_locked{ locked } {}
 		template<typename...TArgs>
 			requires (std::constructible_from<locked_datum_t, TArgs...>)
 		ctrl_block(TArgs&&... args)
-			noexcept(cjm::concepts::nothrow_constructible_from<locked_datum_t, 
-				TArgs...>)			
-				: m_mutex{}, m_condition_variable{},
-					m_locked{ std::forward<TArgs>(args)... } {}
+			noexcept(cjm::concepts::nothrow_constructible_from<locked_datum_t,
+				TArgs...>)
+			: m_mutex{}, m_condition_variable{}, m_sequence{0},
+			m_locked{ std::forward<TArgs>(args)... } {}
 
-		mutable mutex_t m_mutex;
-		mutable condition_variable_t m_condition_variable;
+		alignas(layout_t::template lock_align<mutex_t>) mutable mutex_t m_mutex;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS alignas(layout_t::template cold_align<condition_variable_t>)
+			mutable condition_variable_t m_condition_variable;
+		alignas(layout_t::template hot_align<std::atomic<sequence_t>>) std::atomic<sequence_t> m_sequence;
 		locked_datum_t m_locked;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS mutable stats_t m_stats;
 	};
-	template<typename TLocked>
-	class locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>
+
+	template<typename TLocked, concepts::mutex TMutex>
+	class locked_ptr_base<TLocked, TMutex, concepts::mutex_level::seqlock>
 	{
 	public:
-		using scoped_unlock_t = scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
-		friend class scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using release_notifier_t = release_notifier_for_t<TLocked, TMutex, concepts::mutex_level::seqlock>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::seqlock>;
+		friend scoped_unlock_t;
 		using locked_t = std::remove_reference_t<TLocked>;
-		using mutex_t = std::mutex;
-		using lock_t = std::unique_lock<std::mutex>;
-		using condition_variable_t = std::condition_variable;
-		using locked_ptr_t = std::add_pointer_t<lock_t>;
-		using ctrl_blck_t = ctrl_block<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
-		friend class ctrl_blck_t;
+		using mutex_t = TMutex;
+		using lock_t = std::unique_lock<TMutex>;
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::seqlock>;
+		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
+		using synchro_vault_t = synchro_vault_base<TLocked, TMutex, concepts::mutex_level::seqlock>;
+		friend ctrl_blck_t;
+		friend synchro_vault_t;
 		using ctrl_blck_ptr_t = std::add_pointer_t<ctrl_blck_t>;
+		using stats_t = typename ctrl_blck_t::stats_t;
+		using hold_timer_t = typename stats_t::hold_timer_t;
 		static constexpr concepts::time_type condition_variable_time = ctrl_blck_t::condition_variable_time;
 
 		using unlocker_data_t = std::pair<std::unique_lock<mutex_t>, ctrl_blck_ptr_t>;
 		~locked_ptr_base();
 		locked_ptr_base(const locked_ptr_base& other) = delete;
-		locked_ptr_base(locked_ptr_base&& other) noexcept = delete;
+		locked_ptr_base(locked_ptr_base&& other) noexcept
+			: m_release_notifier{ std::move(other.m_release_notifier) },
+			m_lock{ std::move(other.m_lock) }, m_ctrl_blck{ std::exchange(other.m_ctrl_blck, nullptr) },
+			m_hold_timer{ other.m_hold_timer } {}
 		locked_ptr_base& operator=(const locked_ptr_base& other) = delete;
-		locked_ptr_base& operator=(locked_ptr_base&& other) noexcept = delete;
+		locked_ptr_base& operator=(locked_ptr_base&& other) noexcept;
 
 	protected:
 
 		lock_release_notify lock_release_setting() const noexcept
 		{
-			return m_cv_notify_on_destruct.load();
+			return m_release_notifier.setting();
 		}
 
-		[[nodiscard]] scoped_unlock_t scoped_unlock_impl();
+		void release_impl() noexcept;
+
+		[[nodiscard]] scoped_unlock_t scoped_unlock_impl(const call_site_t& site);
 
 		void notify_one_impl()
 		{
@@ -202,91 +4120,97 @@ namespace cjm::synchro::detail
 		}
 
 		void set_cv_release_notification(lock_release_notify lrn)
+			requires (release_notifier_t::policy == release_notify_policy::runtime)
 		{
 			assert(lrn >= lock_release_notify::none && lrn <= lock_release_notify::all);
-			m_cv_notify_on_destruct.store(lrn);
-		}
-
-		template<concepts::duration Duration>
-		void wait_for_impl(const Duration& d)
-		{
-			assert(is_locked_impl());
-			static_assert(
-				(concepts::detail::std_duration<Duration> ||
-					concepts::detail::boost_duration<Duration>)
-				&&
-				!(concepts::detail::std_duration<Duration> &&
-					concepts::detail::boost_duration<Duration>));
-			m_ctrl_blck->m_condition_variable.wait_for(d);
+			m_release_notifier.set(lrn);
 		}
 
-		template<concepts::duration Duration, std::predicate<bool()> Predicate>
+		template<concepts::duration Duration, std::predicate Predicate>
 		void wait_for_impl(const Duration& d, Predicate p)
 		{
 			assert(is_locked_impl());
-			m_ctrl_blck->m_condition_variable.wait_for(d, p);
-		}
-
-		template<concepts::time_point TimePoint>
-		void wait_until_impl(const TimePoint& tp)
-		{
-			assert(is_locked_impl());
-			static_assert(
-				(concepts::detail::boost_time_point<TimePoint> ||
-					concepts::detail::std_time_point<TimePoint>)
-				&&
-				!(concepts::detail::boost_time_point<TimePoint> &&
-					concepts::detail::std_time_point<TimePoint>));
-			m_ctrl_blck->m_condition_variable.wait_until(tp);
+			m_ctrl_blck->end_write();
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_for(m_lock, d, p);
+			m_ctrl_blck->begin_write();
 		}
 
-		template<concepts::time_point TimePoint, std::predicate<bool()> Predicate>
+		template<concepts::time_point TimePoint, std::predicate Predicate>
 		void wait_until_impl(const TimePoint& tp, Predicate p)
 		{
 			assert(is_locked_impl());
-			static_assert(
-				(concepts::detail::boost_time_point<TimePoint> ||
-					concepts::detail::std_time_point<TimePoint>)
-				&&
-				!(concepts::detail::boost_time_point<TimePoint> &&
-					concepts::detail::std_time_point<TimePoint>));
-			m_ctrl_blck->m_condition_variable.wait_until(tp, p);
+			m_ctrl_blck->end_write();
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait_until(m_lock, tp, p);
+			m_ctrl_blck->begin_write();
 		}
 
 		void wait_impl()
 		{
 			assert(is_locked_impl());
-			m_ctrl_blck->m_condition_variable.wait();
+			m_ctrl_blck->end_write();
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			m_ctrl_blck->m_condition_variable.wait(m_lock);
+			m_ctrl_blck->begin_write();
 		}
 
-		template<std::predicate<bool()> Predicate>
+		template<std::predicate Predicate>
 		void wait_impl(Predicate p)
 		{
 			assert(is_locked_impl());
-			m_ctrl_blck->m_condition_variable.wait(m_lock, p);
+			m_ctrl_blck->end_write();
+			[[maybe_unused]] auto paused = m_hold_timer.pause(m_ctrl_blck->m_stats);
+			if constexpr (ctrl_blck_t::stats_t::enabled)
+			{
+				bool woken = false;
+				m_ctrl_blck->m_condition_variable.wait(m_lock, m_ctrl_blck->m_stats.count_wakeups(p, woken));
+			}
+			else
+			{
+				m_ctrl_blck->m_condition_variable.wait(m_lock, p);
+			}
+			m_ctrl_blck->begin_write();
 		}
 
-		[[nodiscard]] std::add_lvalue_reference<locked_t> locked_value() const;
-
+		[[nodiscard]] std::add_lvalue_reference_t<locked_t> locked_value() const
+		{
+			assert(is_locked_impl() && m_ctrl_blck != nullptr);
+			return m_ctrl_blck->m_locked;
+		}
 
 		[[nodiscard]] bool is_empty_impl() const noexcept
 		{
 			return get_mutex_impl() == nullptr && m_ctrl_blck == nullptr;
 		}
 
-		void lock_impl(unlocker_data_t unlocker_data)
+		void lock_impl(unlocker_data_t unlocker_data, const call_site_t& site)
 		{
 			assert(!is_locked_impl());
 			m_lock = std::move(unlocker_data.first);
 			m_ctrl_blck = unlocker_data.second;
 			assert(m_ctrl_blck != nullptr && m_lock.mutex() != nullptr && !m_lock.owns_lock());
-			m_lock.lock();
+			if constexpr (stats_t::enabled)
+			{
+				m_ctrl_blck->m_stats.lock(m_lock, site);
+				m_hold_timer.start();
+			}
+			else
+			{
+				m_lock.lock();
+			}
+			m_ctrl_blck->begin_write();
 			assert(is_locked_impl());
 		}
 
 		unlocker_data_t unlock_impl()
 		{
 			assert(is_locked_impl());
+			m_ctrl_blck->end_write();
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
 			unlocker_data_t ret = std::make_pair(std::move(m_lock), m_ctrl_blck);
 			m_ctrl_blck = nullptr;
 			ret.first.unlock();
@@ -296,7 +4220,7 @@ namespace cjm::synchro::detail
 
 		[[nodiscard]] bool is_locked_impl() const noexcept
 		{
-			assert(m_lock.mutex() != nullptr && (!m_lock.owns_lock || m_ctrl_blck != nullptr));
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
 			return m_lock.owns_lock();
 		}
 
@@ -305,149 +4229,190 @@ namespace cjm::synchro::detail
 			return m_lock.mutex();
 		}
 
-		explicit locked_ptr_base(std::unique_lock<mutex_t> lock, ctrl_blck_ptr_t locked) : m_lock{ std::move(lock) }, m_ctrl_blck{ locked }
+		explicit locked_ptr_base(std::unique_lock<mutex_t> lock, ctrl_blck_ptr_t locked, const call_site_t& site = call_site_t{}) : m_lock{ std::move(lock) }, m_ctrl_blck{ locked }
 		{
-			assert(!m_lock.owns_lock || m_ctrl_blck != nullptr);
+			assert(!m_lock.owns_lock() || m_ctrl_blck != nullptr);
+			if constexpr (stats_t::enabled)
+			{
+				if (m_lock.owns_lock())
+				{
+					m_hold_timer.start(site);
+				}
+			}
+			if (m_lock.owns_lock())
+			{
+				m_ctrl_blck->begin_write();
+			}
 		}
 		locked_ptr_base() = default;
 	private:
 
-		std::atomic<lock_release_notify> m_cv_notify_on_destruct;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS release_notifier_t m_release_notifier;
 		lock_t m_lock;
-		ctrl_blck_ptr_t m_ctrl_blck;
+		ctrl_blck_ptr_t m_ctrl_blck{nullptr};
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS hold_timer_t m_hold_timer;
 	};
 
-
-
-	template <typename TLocked>
-	class scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>
+	template <typename TLocked, concepts::mutex TMutex>
+	class scoped_unlock<TLocked, TMutex, concepts::mutex_level::seqlock>
 	{
 	public:
-		using locked_ptr_base_t = locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
-		using pointer_t = typename locked_ptr_base_t::locked_ptr_t;
+		using locked_ptr_base_t = locked_ptr_base<TLocked, TMutex, concepts::mutex_level::seqlock>;
+		using unlocker_data_t = typename locked_ptr_base_t::unlocker_data_t;
+		using call_site_t = typename locked_ptr_base_t::call_site_t;
 		scoped_unlock& operator=(scoped_unlock&& other) noexcept = delete;
 		scoped_unlock& operator=(const scoped_unlock& other) = delete;
 		scoped_unlock() = delete;
 		scoped_unlock(scoped_unlock&& other) noexcept = delete;
 		scoped_unlock(const scoped_unlock& other) = delete;
-		scoped_unlock(locked_ptr_base_t& locked_ptr) : m_ptr(&locked_ptr)
+		explicit scoped_unlock(locked_ptr_base_t& locked_ptr, const call_site_t& site) : m_unlocker_data{}, m_ptr(&locked_ptr), m_site{ site }
 		{
 			assert(locked_ptr.is_locked_impl());
-			m_locked_val = &(m_ptr->m_ctrl_blck->m_locked);
-			locked_ptr.m_lock.unlock();
-			assert(!m_ptr->is_locked_impl() && m_ptr->m_locked == nullptr && m_locked_val != nullptr);
+			m_unlocker_data = locked_ptr.unlock_impl();
+			assert(!m_ptr->is_locked_impl() && m_unlocker_data.second != nullptr);
 		}
 		~scoped_unlock()
 		{
 			assert(static_cast<bool>(m_ptr) && !m_ptr->is_locked_impl());
-			m_ptr->lock_impl();
-			std::swap(m_locked_val, m_ptr->m_ctrl_blck);
+			m_ptr->lock_impl(std::move(m_unlocker_data), m_site);
 			assert(m_ptr->is_locked_impl());
 		}
 
 	private:
-		pointer_t m_locked_val;
+		unlocker_data_t m_unlocker_data;
 		locked_ptr_base_t* m_ptr;
+		CJM_SYNCHRO_NO_UNIQUE_ADDRESS call_site_t m_site;
 	};
 
-	template<typename TLocked>
-	class synchro_vault_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>
+	template<typename TLocked, concepts::mutex TMutex>
+	class synchro_vault_base<TLocked, TMutex, concepts::mutex_level::seqlock>
 	{
 	protected:
-		using ctrl_blck_t = ctrl_block<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
-		using scoped_unlock_t = scoped_unlock<TLocked, std::mutex, concepts::mutex_level::std_mutex>;
+		using ctrl_blck_t = ctrl_block<TLocked, TMutex, concepts::mutex_level::seqlock>;
+		using scoped_unlock_t = scoped_unlock<TLocked, TMutex, concepts::mutex_level::seqlock>;
 		using locked_t = typename ctrl_blck_t::locked_datum_t;
 		using mutex_t = typename ctrl_blck_t::mutex_t;
 		using lock_t = typename ctrl_blck_t::lock_t;
 		using condition_variable_t = typename ctrl_blck_t::condition_variable_t;
+		using call_site_t = typename ctrl_blck_t::call_site_t;
 		using ptr_to_locked = typename ctrl_blck_t::ptr_to_locked_datum;
 		using unlocker_data_t = typename ctrl_blck_t::unlocker_data_t;
 		using vault_owner_t = typename ctrl_blck_t::vault_owner_t;
-		static_assert(std::is_same_v<synchro_vault_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>, vault_owner_t>);
+		static_assert(std::is_same_v<synchro_vault_base<TLocked, TMutex, concepts::mutex_level::seqlock>, vault_owner_t>);
 		using locked_ptr_t = typename ctrl_blck_t::locked_ptr_t;
-		friend class ctrl_blck_t;
-		friend class scoped_unlock_t;		
+		friend ctrl_blck_t;
+		friend scoped_unlock_t;
 
 		synchro_vault_base() noexcept(std::is_nothrow_default_constructible_v<locked_t>)
 			requires (std::is_default_constructible_v<locked_t>) : m_ctrl_blck{} {}
 		synchro_vault_base(const locked_t& locked_datum) noexcept(std::is_nothrow_copy_constructible_v<locked_t>)
 			requires (std::copy_constructible<locked_t>) : m_ctrl_blck{ locked_datum } {}
-		synchro_vault_base(locked_t&& locked_datum) noexcept(std::is_nothrow_move_constructible_v<locked_t>)
-			requires (std::move_constructible<locked_t>) : m_ctrl_blck{ std::move(locked_datum) } {}
 		template<typename...TArgs>
 		requires (std::constructible_from<locked_t, TArgs...>)
 			synchro_vault_base(TArgs&&... args) noexcept(cjm::concepts::nothrow_constructible_from<locked_t,
 				TArgs...>) : m_ctrl_blck{ std::forward<TArgs>(args)... } {}
 
-		[[nodiscard]] locked_ptr_t lock_impl() 
+		[[nodiscard]] locked_ptr_t lock_impl(const call_site_t& site)
 		{
-			return locked_ptr_t{ lock_t{m_ctrl_blck.m_mutex}, &m_ctrl_blck };
+			return locked_ptr_t{ acquire_lock<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex, site), &m_ctrl_blck, site };
 		}
 
-		void notify_one_impl() 
+		[[nodiscard]] lock_t defer_lock_impl() const
+		{
+			return lock_t{ m_ctrl_blck.m_mutex, std::defer_lock };
+		}
+
+		[[nodiscard]] locked_ptr_t adopt_lock_impl(lock_t lock, const call_site_t& site = call_site_t{})
+		{
+			assert(lock.owns_lock() && lock.mutex() == &m_ctrl_blck.m_mutex);
+			m_ctrl_blck.m_stats.adopt(lock, site);
+			return locked_ptr_t{ std::move(lock), &m_ctrl_blck, site };
+		}
+
+		void notify_one_impl()
 		{
 			m_ctrl_blck.m_condition_variable.notify_one();
 		}
 
-		void notify_all_impl() 
+		void notify_all_impl()
 		{
 			m_ctrl_blck.m_condition_variable.notify_all();
 		}
 
+		[[nodiscard]] typename ctrl_blck_t::stats_t& stats_impl() const noexcept
+		{
+			return m_ctrl_blck.m_stats;
+		}
 
-		[[nodiscard]] auto copy_locked_datum() const
-			noexcept(std::is_nothrow_copy_constructible_v<locked_t>)->locked_t
-			requires (std::copy_constructible<locked_t>)
+		[[nodiscard]] auto copy_locked_datum() const noexcept -> locked_t
 		{
-			auto lock = locked_t{ m_ctrl_blck.m_mutex };
-			return m_ctrl_blck.m_locked;
+			return m_ctrl_blck.read_optimistic();
 		}
 
 		auto release_locked_datum() noexcept -> locked_t
-			requires (std::is_nothrow_move_constructible_v<locked_t>&& std::is_nothrow_default_constructible_v<locked_t>)
+			requires (std::is_nothrow_default_constructible_v<locked_t>)
 		{
-			locked_t def_val;
-			auto lock = locked_t{ m_ctrl_blck.m_mutex };
-			std::swap(m_ctrl_blck.m_locked, def_val);
-			return def_val;
+			return swap_locked_datum(locked_t{});
 		}
 
 		auto swap_locked_datum(locked_t&& swap_me) noexcept -> locked_t
-			requires (std::is_nothrow_swappable_v<locked_t>)
 		{
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.begin_write();
 			std::swap(swap_me, m_ctrl_blck.m_locked);
+			m_ctrl_blck.end_write();
 			return swap_me;
 		}
 
-		void assign_locked_datum(const locked_t& new_datum)
-			noexcept (std::is_nothrow_copy_assignable_v<locked_t>)
-			requires(std::is_copy_assignable_v<locked_t>)
+		void assign_locked_datum(const locked_t& new_datum) noexcept
 		{
-			auto lck = lock_t{ m_ctrl_blck.m_mutex };
+			auto lck = scoped_acquire<lock_t>(m_ctrl_blck.m_stats, m_ctrl_blck.m_mutex);
+			m_ctrl_blck.begin_write();
 			m_ctrl_blck.m_locked = new_datum;
+			m_ctrl_blck.end_write();
 		}
 
-		void assign_locked_datum(locked_t&& new_datum)
-			noexcept(std::is_nothrow_move_assignable_v<locked_t>)
-			requires(std::is_move_assignable_v<locked_t>)
-		{
-			auto lck = lock_t{ m_ctrl_blck.m_mutex };
-			m_ctrl_blck.m_locked = std::move(new_datum);
-		}
-	
 	private:
 		ctrl_blck_t m_ctrl_blck;
 	};
 
-	template <typename TLocked>
-	locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::~locked_ptr_base()
+	template <typename TLocked, concepts::mutex TMutex>
+	locked_ptr_base<TLocked, TMutex, concepts::mutex_level::seqlock>::~locked_ptr_base()
+	{
+		release_impl();
+	}
+
+	template <typename TLocked, concepts::mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::seqlock>::operator=(locked_ptr_base&& other) noexcept -> locked_ptr_base&
+	{
+		if (this != &other)
+		{
+			release_impl();
+			m_release_notifier = std::move(other.m_release_notifier);
+			m_lock = std::move(other.m_lock);
+			m_ctrl_blck = std::exchange(other.m_ctrl_blck, nullptr);
+			m_hold_timer = other.m_hold_timer;
+		}
+		return *this;
+	}
+
+	template <typename TLocked, concepts::mutex TMutex>
+	void locked_ptr_base<TLocked, TMutex, concepts::mutex_level::seqlock>::release_impl() noexcept
 	{
-		const lock_release_notify notify =
-			m_cv_notify_on_destruct.exchange(lock_release_notify::none);
+		const lock_release_notify notify = m_release_notifier.take();
 		if (m_lock.owns_lock())
 		{
+			if constexpr (stats_t::enabled)
+			{
+				m_hold_timer.stop(m_ctrl_blck->m_stats);
+			}
+			m_ctrl_blck->end_write();
 			m_lock.unlock();
 		}
+		if (m_ctrl_blck == nullptr)
+		{
+			return;
+		}
 		if (notify == lock_release_notify::one)
 		{
 			m_ctrl_blck->m_condition_variable.notify_one();
@@ -456,19 +4421,13 @@ namespace cjm::synchro::detail
 		{
 			m_ctrl_blck->m_condition_variable.notify_all();
 		}
+		m_ctrl_blck = nullptr;
 	}
 
-	template <typename TLocked>
-	auto locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::scoped_unlock_impl() -> scoped_unlock_t
-	{
-		return scoped_unlock_t{ *this };
-	}
-
-	template <typename TLocked>
-	auto locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::locked_value() const -> std::add_lvalue_reference<typename locked_ptr_base<TLocked, std::mutex, concepts::mutex_level::std_mutex>::locked_t>
+	template <typename TLocked, concepts::mutex TMutex>
+	auto locked_ptr_base<TLocked, TMutex, concepts::mutex_level::seqlock>::scoped_unlock_impl(const call_site_t& site) -> scoped_unlock_t
 	{
-		assert(is_locked_impl() && m_ctrl_blck != nullptr);
-		return m_ctrl_blck->m_locked;
+		return scoped_unlock_t{ *this, site };
 	}
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,514 @@
+#ifndef CJM_SYNCHRO_TRACE_HPP_
+#define CJM_SYNCHRO_TRACE_HPP_
+#include "cjm_synchro_syncbase.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace cjm::synchro
+{
+	enum class trace_event_kind : std::uint8_t
+	{
+		wait = 0,
+		hold
+	};
+
+	// One interval taken from the per-thread buffers.  start_ns is on detail::stats_clock, which
+	// has no meaningful epoch; vault is the address stats_registry reports for the vault and
+	// vault_name its stats name when the event was collected, if it had one; file and function
+	// point at the static strings of the std::source_location that was captured.
+	struct trace_event
+	{
+		trace_event_kind kind{ trace_event_kind::wait };
+		std::uint32_t thread{ 0 };
+		std::uint32_t line{ 0 };
+		std::int64_t start_ns{ 0 };
+		std::int64_t duration_ns{ 0 };
+		const void* vault{ nullptr };
+		std::shared_ptr<const std::string> vault_name;
+		const char* file{ "" };
+		const char* function{ "" };
+	};
+
+	class lock_trace;
+}
+
+namespace cjm::synchro::detail
+{
+	// Single-producer ring of trace events owned by one thread.  Pushing is a handful of relaxed
+	// stores; a collector on another thread copies what was published and afterwards checks the
+	// reservation counter, discarding any slot the producer may have started overwriting while it
+	// read (the same validation a seqlock reader does).  Every field is atomic, so a torn slot is
+	// detected rather than being a data race.
+	class trace_ring
+	{
+	public:
+		static constexpr std::size_t capacity = std::size_t{ 1 } << 13;
+
+		explicit trace_ring(std::uint32_t thread) noexcept : m_thread{ thread } {}
+		trace_ring(const trace_ring& other) = delete;
+		trace_ring(trace_ring&& other) noexcept = delete;
+		trace_ring& operator=(const trace_ring& other) = delete;
+		trace_ring& operator=(trace_ring&& other) noexcept = delete;
+		~trace_ring() = default;
+
+		void push(trace_event_kind kind, std::int64_t start_ns, std::int64_t duration_ns, const void* vault,
+			const std::source_location& site) noexcept
+		{
+			const std::uint64_t index = m_published.load(std::memory_order_relaxed);
+			m_reserved.store(index + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			slot_t& slot = m_slots[index % capacity];
+			slot.start_ns.store(start_ns, std::memory_order_relaxed);
+			slot.duration_ns.store(duration_ns, std::memory_order_relaxed);
+			slot.vault.store(vault, std::memory_order_relaxed);
+			slot.file.store(site.file_name(), std::memory_order_relaxed);
+			slot.function.store(site.function_name(), std::memory_order_relaxed);
+			slot.line_and_kind.store((std::uint64_t{ site.line() } << 8) | static_cast<std::uint64_t>(kind), std::memory_order_relaxed);
+			m_published.store(index + 1, std::memory_order_release);
+		}
+
+		// Collector side, serialized by lock_trace.  Appends the events published since the last
+		// drain and returns how many were overwritten before they could be read.
+		std::uint64_t drain(std::vector<trace_event>& out)
+		{
+			const std::uint64_t published = m_published.load(std::memory_order_acquire);
+			std::uint64_t first = published > capacity && published - capacity > m_drained ? published - capacity : m_drained;
+			const std::size_t base = out.size();
+			for (std::uint64_t index = first; index < published; ++index)
+			{
+				const slot_t& slot = m_slots[index % capacity];
+				const std::uint64_t line_and_kind = slot.line_and_kind.load(std::memory_order_relaxed);
+				trace_event event;
+				event.kind = static_cast<trace_event_kind>(line_and_kind & 0xff);
+				event.thread = m_thread;
+				event.line = static_cast<std::uint32_t>(line_and_kind >> 8);
+				event.start_ns = slot.start_ns.load(std::memory_order_relaxed);
+				event.duration_ns = slot.duration_ns.load(std::memory_order_relaxed);
+				event.vault = slot.vault.load(std::memory_order_relaxed);
+				event.file = slot.file.load(std::memory_order_relaxed);
+				event.function = slot.function.load(std::memory_order_relaxed);
+				out.push_back(event);
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const std::uint64_t reserved = m_reserved.load(std::memory_order_relaxed);
+			const std::uint64_t valid_from = reserved > capacity ? reserved - capacity : 0;
+			if (valid_from > first)
+			{
+				const auto torn = static_cast<std::size_t>(std::min(valid_from, published) - first);
+				out.erase(out.begin() + static_cast<std::ptrdiff_t>(base), out.begin() + static_cast<std::ptrdiff_t>(base + torn));
+				first += torn;
+			}
+			const std::uint64_t dropped = first - m_drained;
+			m_drained = published;
+			return dropped;
+		}
+
+		void retire() noexcept
+		{
+			m_retired.store(true, std::memory_order_release);
+		}
+
+		[[nodiscard]] bool is_retired() const noexcept
+		{
+			return m_retired.load(std::memory_order_acquire);
+		}
+
+	private:
+		struct slot_t
+		{
+			std::atomic<std::int64_t> start_ns{ 0 };
+			std::atomic<std::int64_t> duration_ns{ 0 };
+			std::atomic<const void*> vault{ nullptr };
+			std::atomic<const char*> file{ nullptr };
+			std::atomic<const char*> function{ nullptr };
+			std::atomic<std::uint64_t> line_and_kind{ 0 };
+		};
+
+		std::atomic<std::uint64_t> m_published{ 0 };
+		std::atomic<std::uint64_t> m_reserved{ 0 };
+		std::atomic<bool> m_retired{ false };
+		const std::uint32_t m_thread;
+		// Touched only by the collector.
+		std::uint64_t m_drained{ 0 };
+		std::array<slot_t, capacity> m_slots{};
+	};
+}
+
+namespace cjm::synchro
+{
+	// Timeline of lock waits and holds recorded by vaults declared stats_policy::traced: every
+	// contended wait, and the holds hold_timer<true> samples.  Each thread writes into its own
+	// trace_ring without locking; collect() moves the buffered events here and should be called
+	// often enough that no ring wraps.  dropped() counts what did, and the events of threads
+	// whose ring could not be allocated.
+	// flush_chrome_trace() writes everything collected as Chrome trace-event JSON, which
+	// chrome://tracing and ui.perfetto.dev open directly: one track per thread, so nested
+	// acquisitions stack and convoys line up.
+	class lock_trace
+	{
+	public:
+		[[nodiscard]] static lock_trace& instance()
+		{
+			static lock_trace trace;
+			return trace;
+		}
+
+		lock_trace(const lock_trace& other) = delete;
+		lock_trace(lock_trace&& other) noexcept = delete;
+		lock_trace& operator=(const lock_trace& other) = delete;
+		lock_trace& operator=(lock_trace&& other) noexcept = delete;
+
+		// Appends one interval to the calling thread's ring.  The first call on a thread allocates
+		// and registers the ring; every later one is lock-free.  If that allocation fails the
+		// thread's events are counted as dropped instead.
+		static void record(trace_event_kind kind, detail::stats_clock::time_point start,
+			detail::stats_clock::time_point stop, const void* vault, const std::source_location& site) noexcept
+		{
+			detail::trace_ring* ring = local_ring();
+			if (ring == nullptr) [[unlikely]]
+			{
+				instance().m_unrecorded.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			const auto start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count();
+			const auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+			ring->push(kind, start_ns, duration_ns, vault, site);
+		}
+
+		std::size_t collect()
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			return collect_locked();
+		}
+
+		[[nodiscard]] std::vector<trace_event> events()
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			collect_locked();
+			return m_events;
+		}
+
+		[[nodiscard]] std::uint64_t dropped() const
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			return m_dropped + m_unrecorded.load(std::memory_order_relaxed);
+		}
+
+		// Names are attached to events as they are collected.  A named vault collects on its way
+		// out, so its events keep the name even though another vault may reuse the address.
+		void name_vault(const void* vault, std::string name)
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			collect_locked();
+			m_names[vault] = std::make_shared<const std::string>(std::move(name));
+		}
+
+		void forget_vault(const void* vault)
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			if (m_names.contains(vault))
+			{
+				collect_locked();
+				m_names.erase(vault);
+			}
+		}
+
+		void clear()
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			collect_locked();
+			m_events.clear();
+			m_dropped = 0;
+			m_unrecorded.store(0, std::memory_order_relaxed);
+		}
+
+		// Collects, writes every collected event and discards them.  Timestamps are microseconds
+		// since the trace was created.
+		void flush_chrome_trace(std::ostream& os)
+		{
+			auto lck = std::unique_lock<std::mutex>{ m_mutex };
+			collect_locked();
+			os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+			bool first = true;
+			for (const trace_event& event : m_events)
+			{
+				os << (first ? "\n" : ",\n");
+				first = false;
+				write_event(os, event);
+			}
+			os << "\n]}\n";
+			m_events.clear();
+		}
+
+		bool flush_chrome_trace(const std::string& path)
+		{
+			auto file = std::ofstream{ path, std::ios::out | std::ios::trunc };
+			if (!file)
+			{
+				return false;
+			}
+			flush_chrome_trace(static_cast<std::ostream&>(file));
+			return static_cast<bool>(file.flush());
+		}
+
+	private:
+		// Keeps the thread's ring alive in the registry after the thread exits, so its last
+		// events are still collected; collect() frees retired rings once drained.  Holds null if
+		// the ring could not be allocated.
+		class ring_owner
+		{
+		public:
+			ring_owner() noexcept : m_ring{ instance().attach() } {}
+			ring_owner(const ring_owner& other) = delete;
+			ring_owner(ring_owner&& other) noexcept = delete;
+			ring_owner& operator=(const ring_owner& other) = delete;
+			ring_owner& operator=(ring_owner&& other) noexcept = delete;
+			~ring_owner()
+			{
+				if (m_ring != nullptr)
+				{
+					m_ring->retire();
+				}
+			}
+
+			[[nodiscard]] detail::trace_ring* ring() const noexcept { return m_ring; }
+
+		private:
+			detail::trace_ring* m_ring;
+		};
+
+		lock_trace() = default;
+		~lock_trace() = default;
+
+		[[nodiscard]] static detail::trace_ring* local_ring() noexcept
+		{
+			thread_local const ring_owner owner;
+			return owner.ring();
+		}
+
+		detail::trace_ring* attach() noexcept
+		{
+			try
+			{
+				auto lck = std::unique_lock<std::mutex>{ m_mutex };
+				auto ring = std::unique_ptr<detail::trace_ring>{ new (std::nothrow) detail::trace_ring{ m_next_thread } };
+				if (ring == nullptr)
+				{
+					return nullptr;
+				}
+				m_rings.push_back(std::move(ring));
+				++m_next_thread;
+				return m_rings.back().get();
+			}
+			catch (...)
+			{
+				return nullptr;
+			}
+		}
+
+		std::size_t collect_locked()
+		{
+			const std::size_t before = m_events.size();
+			for (auto it = m_rings.begin(); it != m_rings.end();)
+			{
+				const bool retired = (*it)->is_retired();
+				m_dropped += (*it)->drain(m_events);
+				it = retired ? m_rings.erase(it) : it + 1;
+			}
+			for (std::size_t index = before; index < m_events.size(); ++index)
+			{
+				if (const auto it = m_names.find(m_events[index].vault); it != m_names.end())
+				{
+					m_events[index].vault_name = it->second;
+				}
+			}
+			return m_events.size() - before;
+		}
+
+		void write_event(std::ostream& os, const trace_event& event) const
+		{
+			const std::string_view file{ event.file };
+			const auto slash = file.find_last_of("/\\");
+			const std::string_view base = slash == std::string_view::npos ? file : file.substr(slash + 1);
+			const auto since_origin = event.start_ns -
+				std::chrono::duration_cast<std::chrono::nanoseconds>(m_origin.time_since_epoch()).count();
+
+			os << "{\"name\":\"" << (event.kind == trace_event_kind::wait ? "wait " : "hold ");
+			if (event.line == 0)
+			{
+				os << "(unknown site)";
+			}
+			else
+			{
+				write_escaped(os, base);
+				os << ':' << event.line;
+			}
+			os << "\",\"cat\":\"" << (event.kind == trace_event_kind::wait ? "wait" : "hold")
+				<< "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+				<< ",\"ts\":";
+			write_microseconds(os, since_origin);
+			os << ",\"dur\":";
+			write_microseconds(os, event.duration_ns);
+			os << ",\"args\":{\"vault\":\"";
+			if (event.vault_name != nullptr)
+				write_escaped(os, *event.vault_name);
+			else
+				os << "vault@" << event.vault;
+			os << "\",\"file\":\"";
+			write_escaped(os, file);
+			os << "\",\"function\":\"";
+			write_escaped(os, event.function);
+			os << "\"}}";
+		}
+
+		static void write_microseconds(std::ostream& os, std::int64_t ns)
+		{
+			const auto flags = os.flags();
+			const auto precision = os.precision();
+			os << std::fixed << std::setprecision(3) << static_cast<double>(ns) / 1000.0;
+			os.flags(flags);
+			os.precision(precision);
+		}
+
+		static void write_escaped(std::ostream& os, std::string_view text)
+		{
+			constexpr char hex[] = "0123456789abcdef";
+			for (const char c : text)
+			{
+				if (c == '"' || c == '\\')
+					os << '\\' << c;
+				else if (static_cast<unsigned char>(c) < 0x20)
+					os << "\\u00" << hex[(c >> 4) & 0xf] << hex[c & 0xf];
+				else
+					os << c;
+			}
+		}
+
+		mutable std::mutex m_mutex;
+		std::vector<std::unique_ptr<detail::trace_ring>> m_rings;
+		std::vector<trace_event> m_events;
+		std::unordered_map<const void*, std::shared_ptr<const std::string>> m_names;
+		std::uint64_t m_dropped{ 0 };
+		std::atomic<std::uint64_t> m_unrecorded{ 0 };
+		std::uint32_t m_next_thread{ 1 };
+		const detail::stats_clock::time_point m_origin{ detail::stats_clock::now() };
+	};
+}
+
+namespace cjm::synchro::detail
+{
+	// Hold timer of traced vaults: a hold that hold_timer<true> would sample also becomes a
+	// trace interval labelled with the call site that acquired the lock.  Timing every hold
+	// would cost two clock reads per lock; sampled holds keep tracing near the cost of stats,
+	// and a hot lock still shows its hold pattern.  A condition wait ends the interval and the
+	// resumed hold, sampled afresh, starts a new one at the same site.
+	class traced_hold_timer
+	{
+	public:
+		static constexpr bool enabled = true;
+		using clock_t = stats_clock;
+
+		void start() noexcept { m_start = hold_timer<true>::sampled() ? clock_t::now() : hold_timer<true>::not_sampled; }
+
+		void start(const std::source_location& site) noexcept
+		{
+			m_site = site;
+			start();
+		}
+
+		template<typename TStats>
+		void stop(TStats& stats) noexcept
+		{
+			if (m_start != hold_timer<true>::not_sampled)
+			{
+				const auto now = clock_t::now();
+				stats.record_hold(now - m_start);
+				stats.trace(trace_event_kind::hold, m_start, now, m_site);
+			}
+		}
+
+		template<typename TStats>
+		[[nodiscard]] hold_pause<traced_hold_timer, TStats> pause(TStats& stats) noexcept
+		{
+			return hold_pause<traced_hold_timer, TStats>{ *this, stats };
+		}
+
+	private:
+		clock_t::time_point m_start{ hold_timer<true>::not_sampled };
+		std::source_location m_site{};
+	};
+
+	// vault_stats plus a trace interval for every contended acquisition and every sampled
+	// exclusive hold.
+	// An uncontended acquisition has no wait worth drawing, so it costs only the try_lock.
+	class traced_vault_stats : public vault_stats
+	{
+	public:
+		static constexpr bool traced = true;
+		using hold_timer_t = traced_hold_timer;
+		using site_t = std::source_location;
+
+		// Creates the trace first, so its origin precedes every interval this vault records.
+		traced_vault_stats() : vault_stats{}
+		{
+			static_cast<void>(lock_trace::instance());
+		}
+		traced_vault_stats(const traced_vault_stats& other) = delete;
+		traced_vault_stats(traced_vault_stats&& other) noexcept = delete;
+		traced_vault_stats& operator=(const traced_vault_stats& other) = delete;
+		traced_vault_stats& operator=(traced_vault_stats&& other) noexcept = delete;
+		~traced_vault_stats()
+		{
+			lock_trace::instance().forget_vault(static_cast<const vault_stats*>(this));
+		}
+
+		void set_name(std::string name)
+		{
+			lock_trace::instance().name_vault(static_cast<const vault_stats*>(this), name);
+			vault_stats::set_name(std::move(name));
+		}
+
+		template<typename TLock>
+		void lock(TLock& lck, const std::source_location& site)
+		{
+			if (lck.try_lock())
+			{
+				record_acquisition(false, clock_t::duration::zero());
+				return;
+			}
+			const auto start = clock_t::now();
+			lck.lock();
+			const auto stop = clock_t::now();
+			record_acquisition(true, stop - start);
+			trace(trace_event_kind::wait, start, stop, site);
+		}
+
+		template<typename TLock>
+		void adopt(TLock&, const std::source_location&) noexcept
+		{
+			record_acquisition(false, clock_t::duration::zero());
+		}
+
+		void trace(trace_event_kind kind, clock_t::time_point start, clock_t::time_point stop,
+			const std::source_location& site) const noexcept
+		{
+			lock_trace::record(kind, start, stop, static_cast<const vault_stats*>(this), site);
+		}
+	};
+}
+#endif
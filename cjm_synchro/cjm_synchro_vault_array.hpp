@@ -0,0 +1,55 @@
+#ifndef CJM_SYNCHRO_VAULT_ARRAY_HPP_
+#define CJM_SYNCHRO_VAULT_ARRAY_HPP_
+#include "cjm_synchro_concepts.hpp"
+#include "cjm_synchro_syncbase.hpp"
+#include "cjm_synchro.hpp"
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+
+namespace cjm::synchro
+{
+	// N independent vaults, each starting on its own cache line and padded out to whole lines, so
+	// that threads working on different elements never contend for a line the way adjacent
+	// vaults in a std::array or std::vector do.  Elements are not movable; the array is built in
+	// place and every vault default-constructs its datum.
+	template<typename TLocked, std::size_t N, concepts::mutex TMutex = std::mutex,
+		concepts::mutex_level Level = concepts::level_v<TMutex>>
+	class vault_array
+	{
+		static_assert(N > 0);
+	public:
+		using vault_t = synchro_vault<TLocked, TMutex, Level>;
+		using locked_ptr_t = typename vault_t::locked_ptr_t;
+		using call_site_t = typename vault_t::call_site_t;
+		static constexpr std::size_t extent = N;
+
+		vault_array() requires (std::is_default_constructible_v<std::remove_reference_t<TLocked>>) = default;
+		vault_array(const vault_array& other) = delete;
+		vault_array(vault_array&& other) noexcept = delete;
+		vault_array& operator=(const vault_array& other) = delete;
+		vault_array& operator=(vault_array&& other) noexcept = delete;
+		~vault_array() = default;
+
+		[[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+
+		[[nodiscard]] vault_t& operator[](std::size_t index) noexcept { return m_slots[index].vault; }
+		[[nodiscard]] const vault_t& operator[](std::size_t index) const noexcept { return m_slots[index].vault; }
+
+		[[nodiscard]] locked_ptr_t lock(std::size_t index, call_site_t site = call_site_t::current())
+		{
+			return m_slots[index].vault.lock(site);
+		}
+
+	private:
+		struct alignas(detail::cache_line_size) slot_t
+		{
+			vault_t vault;
+		};
+		static_assert(sizeof(slot_t) % detail::cache_line_size == 0);
+
+		std::array<slot_t, N> m_slots;
+	};
+}
+#endif